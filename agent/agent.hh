@@ -0,0 +1,80 @@
+#ifndef INCLUDED_AGENT_
+#define INCLUDED_AGENT_
+
+#include <chrono>
+#include <string>
+
+class Vault;
+class Channel;
+
+/**
+ * \brief Serves an unlocked `Vault` over a Unix domain socket.
+ *
+ * Like ssh-agent: the master password is typed (and Argon2 run) once, when
+ * the agent starts; clients then `get` and `add` entries over the socket at
+ * a cost of microseconds. The socket is created with mode 0600 in a
+ * directory only the user can enter, and connections from other users are
+ * refused by peer-credential check. After `idleTimeout` without requests,
+ * or on SIGINT / SIGTERM or a client's `lock` request, the session key is
+ * wiped and `serve` returns. Core dumps of the agent process are disabled.
+ *
+ * Requests and replies are `Channel` messages:
+ *
+ *  - `'G'` website, user           -> `'K'` password
+ *  - `'A'` website, user, policy   -> `'K'` generated password
+ *  - `'S'`                         -> `'K'` stage latency table
+ *  - `'L'`                         -> `'K'` (then the agent stops)
+ *
+ * Failures are answered by `'E'` message.
+ */
+class Agent
+{
+    Vault &d_vault;
+    std::string d_path;
+    std::chrono::seconds d_idleTimeout;
+    int d_listen = -1;
+
+    public:
+        enum Code
+        {
+            GET   = 'G',
+            ADD   = 'A',
+            LOCK  = 'L',
+            STATS = 'S',
+            OK    = 'K',
+            ERROR = 'E'
+        };
+
+        /** Start listening at `path`.
+         *  \throws std::runtime_error if the socket cannot be set up, e.g.
+         *          because another agent already listens there.*/
+        Agent(Vault &vault, std::string path, 
+              std::chrono::seconds idleTimeout);
+
+        Agent(Agent const &other) = delete;
+        Agent &operator=(Agent const &other) = delete;
+
+        /** Close and remove the socket. */
+        ~Agent();
+
+        /** Answer requests until idle timeout, signal or lock request. */
+        void serve();
+
+        /** `$CERBERUS_AGENT_SOCK`, else `$XDG_RUNTIME_DIR/cerberus-agent.sock`,
+         *  else `/tmp/cerberus-<uid>/agent.sock`. */
+        static std::string defaultPath();
+
+    private:
+        /** Create the socket's directory if needed and check that only the
+         *  current user can access it. */
+        void prepareDirectory() const;
+
+        /** Whether the peer on `fd` runs as the current user. */
+        static bool authorized(int fd);
+
+        /** Answer the requests on one connection; false after a lock 
+         *  request. */
+        bool handle(Channel &channel);
+};
+
+#endif
@@ -0,0 +1,51 @@
+#include "agent.ih"
+
+Agent::Agent(Vault &vault, string path, chrono::seconds idleTimeout)
+:
+    d_vault(vault),
+    d_path(move(path)),
+    d_idleTimeout(idleTimeout)
+{
+    rlimit const noCore{ 0, 0 };       // the process holds the session key:
+    setrlimit(RLIMIT_CORE, &noCore);   // keep it out of core dumps and 
+#if defined(__linux__)                 // away from ptrace
+    prctl(PR_SET_DUMPABLE, 0);
+#endif
+
+    prepareDirectory();
+
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (d_path.size() >= sizeof address.sun_path)
+        throw runtime_error("Agent socket path too long: " + d_path);
+    memcpy(address.sun_path, d_path.c_str(), d_path.size() + 1);
+
+    bool live = true;                  // a live agent answers: don't steal
+    try                                // its socket; a stale one is removed
+    {
+        Channel::connect(d_path);
+    }
+    catch (runtime_error const &)
+    {
+        live = false;
+    }
+    if (live)
+        throw runtime_error("An agent already listens on " + d_path);
+    unlink(d_path.c_str());
+
+    d_listen = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (d_listen < 0)
+        throw runtime_error("socket: "s + strerror(errno));
+
+    mode_t const oldMask = umask(0177);// socket is created with mode 0600
+    int const bound = bind(d_listen, reinterpret_cast<sockaddr *>(&address),
+                           sizeof address);
+    umask(oldMask);
+
+    if (bound != 0 || listen(d_listen, SOMAXCONN) != 0)
+    {
+        string const message = strerror(errno);
+        close(d_listen);
+        throw runtime_error("Cannot listen on " + d_path + ": " + message);
+    }
+}
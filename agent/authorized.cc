@@ -0,0 +1,16 @@
+#include "agent.ih"
+                                       // static
+bool Agent::authorized(int fd)
+{
+#if defined(SO_PEERCRED)
+    ucred credentials;
+    socklen_t size = sizeof credentials;
+    if (getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &credentials, &size) != 0)
+        return false;
+    return credentials.uid == getuid();
+#else
+    uid_t uid;
+    gid_t gid;
+    return getpeereid(fd, &uid, &gid) == 0 && uid == getuid();
+#endif
+}
@@ -0,0 +1,12 @@
+#include "agent.ih"
+                                       // static
+string Agent::defaultPath()
+{
+    if (char const *path = getenv("CERBERUS_AGENT_SOCK"); path && *path)
+        return path;
+                                       // per-user, mode 0700 by spec
+    if (char const *runtime = getenv("XDG_RUNTIME_DIR"); runtime && *runtime)
+        return string(runtime) + "/cerberus-agent.sock";
+
+    return "/tmp/cerberus-" + to_string(getuid()) + "/agent.sock";
+}
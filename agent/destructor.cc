@@ -0,0 +1,10 @@
+#include "agent.ih"
+
+Agent::~Agent()
+{
+    if (d_listen >= 0)
+    {
+        close(d_listen);
+        unlink(d_path.c_str());
+    }
+}
@@ -0,0 +1,59 @@
+#include "agent.ih"
+
+bool Agent::handle(Channel &channel)
+{
+    char code;
+    vector<string> fields;
+
+    try
+    {
+        while (channel.receive(code, fields))
+        {
+            try
+            {
+                if (code == GET && fields.size() == 2)
+                {
+                    Secret const password = d_vault.get(fields[0], fields[1]);
+                    channel.send(OK, { password.data() });
+                }
+                else if (code == ADD && fields.size() == 3)
+                {                      // validated first: an ERROR 
+                                       // reply must not hide a stored
+                    auto const policy =// entry
+                        PasswordGenerator::Policy::parse(fields[2]);
+                    if (!Channel::fits({ policy.length }))
+                        throw runtime_error("The password would not fit in "
+                                            "a reply");
+                    Secret const password = d_vault.add(fields[0], fields[1],
+                                                        policy);
+                    channel.send(OK, { password.data() });
+                }
+                else if (code == STATS && fields.empty())
+                {
+                    ostringstream table;
+                    table << StageStats::instance();
+                    string text = table.str();
+                    text.pop_back();   // the client adds the final newline
+                    channel.send(OK, { text });
+                }
+                else if (code == LOCK && fields.empty())
+                {
+                    channel.send(OK, {});
+                    return false;
+                }
+                else
+                    channel.send(ERROR, { "Malformed request" });
+            }
+            catch (exception const &ex)// the request failed, not the 
+            {                          // connection: tell the client
+                channel.send(ERROR, { ex.what() });
+            }
+        }
+    }
+    catch (exception const &ex)        // broken or timed out connection
+    {
+        cerr << "Dropping connection: " << ex.what() << endl;
+    }
+
+    return true;
+}
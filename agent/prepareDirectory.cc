@@ -0,0 +1,18 @@
+#include "agent.ih"
+
+void Agent::prepareDirectory() const
+{
+    string const directory = filesystem::path(d_path).parent_path().string();
+    if (directory.empty())
+        return;
+
+    if (mkdir(directory.c_str(), 0700) != 0 && errno != EEXIST)
+        throw runtime_error("Cannot create " + directory + ": " 
+                            + strerror(errno));
+                                       // a directory someone else prepared
+    struct stat info;                  // in /tmp must not be trusted
+    if (lstat(directory.c_str(), &info) != 0 || !S_ISDIR(info.st_mode)
+        || info.st_uid != getuid() || (info.st_mode & 077) != 0)
+        throw runtime_error(directory + " must be a directory owned by you "
+                            "and inaccessible to others (mode 0700)");
+}
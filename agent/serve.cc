@@ -0,0 +1,70 @@
+#include "agent.ih"
+
+namespace
+{
+    volatile sig_atomic_t s_stop = 0;
+
+    void requestStop(int)
+    {
+        s_stop = 1;
+    }
+
+    enum
+    {
+        RECEIVE_TIMEOUT_SECONDS = 5    // a stalled client can't block others
+    };                                 // for longer than this
+}
+
+void Agent::serve()
+{
+    struct sigaction action{};         // no SA_RESTART: a signal interrupts
+    action.sa_handler = requestStop;   // poll(), so we get to clean up
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGINT, &action, nullptr);
+    sigaction(SIGTERM, &action, nullptr);
+
+    auto deadline = chrono::steady_clock::now() + d_idleTimeout;
+    while (!s_stop)
+    {                                  // poll takes an int of ms: a long
+        int timeout = -1;              // timeout is waited for in slices
+        if (d_idleTimeout.count() != 0)
+            timeout = clamp<long long>(
+                        chrono::duration_cast<chrono::milliseconds>(
+                            deadline - chrono::steady_clock::now()).count(),
+                        0, INT_MAX);
+
+        pollfd ready{ d_listen, POLLIN, 0 };
+        int const count = poll(&ready, 1, timeout);
+        if (count == 0)
+        {
+            if (chrono::steady_clock::now() < deadline)
+                continue;              // only a slice has passed
+            cout << "Idle timeout reached." << endl;
+            break;
+        }
+        if (count < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            throw runtime_error("poll: "s + strerror(errno));
+        }
+
+        int const fd = accept(d_listen, nullptr, nullptr);
+        if (fd < 0)
+            continue;
+
+        Channel channel(fd);
+        if (!authorized(fd))
+            continue;
+
+        timeval const limit{ RECEIVE_TIMEOUT_SECONDS, 0 };
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &limit, sizeof limit);
+
+        if (!handle(channel))
+            break;
+        deadline = chrono::steady_clock::now() + d_idleTimeout;
+    }
+
+    d_vault.lock();
+    cout << "Vault locked, agent stopped." << endl;
+}
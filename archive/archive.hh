@@ -0,0 +1,71 @@
+#ifndef INCLUDED_ARCHIVE_
+#define INCLUDED_ARCHIVE_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <sodium.h>
+#include <span>
+#include <string>
+
+#include "../kdfParams/kdfParams.hh"
+#include "../key/key.hh"
+
+/**
+ * \brief Password-encrypted, chunked file format of vault backups.
+ *
+ * An archive is a header followed by a `crypto_secretstream_xchacha20poly1305`
+ * stream:
+ *
+ *      "CERBBAK1" | opslimit (8) | memlimit (8) | salt (16) | stream header
+ *      chunk...   (each CHUNK_SIZE bytes of input + ABYTES; the last one,
+ *                  shorter, carries the FINAL tag)
+ *
+ * The stream key is derived from a password with Argon2id at the stored 
+ * cost. The header is the additional data of the first chunk, so it is
+ * authenticated, and the FINAL tag detects a truncated archive. Both
+ * directions hold one chunk in memory, whatever the size of the data.
+ */
+struct Archive
+{
+    enum
+    {
+        CHUNK_SIZE  = 64 * 1024,       // plaintext bytes per stream chunk
+        MAGIC_SIZE  = 8,
+        PARAMS_SIZE = 16,              // opslimit and memlimit, little-endian
+        HEADER_SIZE = MAGIC_SIZE + PARAMS_SIZE + crypto_pwhash_SALTBYTES
+                      + crypto_secretstream_xchacha20poly1305_HEADERBYTES
+    };
+                                       // identifies the format and version
+    static constexpr char MAGIC[MAGIC_SIZE + 1] = "CERBBAK1";
+
+    /**
+     * Encrypt everything `in` yields into `out` under `password` and a new
+     * salt, at Argon2 cost `params`. `progress`, if set, gets the number of
+     * bytes written so far after every chunk.
+     * \returns the number of plaintext bytes.
+     * \throws std::runtime_error on I/O or crypto failure.
+     */
+    static size_t seal(std::istream &in, std::ostream &out, 
+                       std::string const &password, KdfParams const &params,
+                       std::function<void(size_t)> const &progress = {});
+
+    /**
+     * Decrypt the archive read from `in` into `out`. Nothing written to
+     * `out` should be trusted unless this returns.
+     * \returns the number of plaintext bytes.
+     * \throws std::runtime_error if `in` is not an archive, the password is
+     *         wrong, or the archive is corrupt or truncated.
+     */
+    static size_t open(std::istream &in, std::ostream &out, 
+                       std::string const &password);
+
+    private:
+        /** Argon2id stream key of `password`.*/
+        static Key streamKey(std::string const &password, 
+                             std::span<std::uint8_t const> salt,
+                             KdfParams const &params);
+};
+
+#endif
@@ -0,0 +1,71 @@
+#include "archive.ih"
+
+namespace
+{
+    uint64_t getUint64(uint8_t const *in)
+    {
+        uint64_t value = 0;
+        for (size_t idx = 8; idx-- != 0; )
+            value = value << 8 | in[idx];
+        return value;
+    }
+}
+
+size_t Archive::open(istream &in, ostream &out, string const &password)
+{
+    array<uint8_t, HEADER_SIZE> header;
+    in.read(reinterpret_cast<char *>(header.data()), header.size());
+    if (static_cast<size_t>(in.gcount()) != header.size() 
+        || memcmp(header.data(), MAGIC, MAGIC_SIZE) != 0)
+        throw runtime_error("Not a cerberus backup");
+
+    uint8_t const *field = header.data() + MAGIC_SIZE;
+    KdfParams params;
+    params.opsLimit = getUint64(field);
+    params.memLimit = getUint64(field += 8);
+    params.validate();                 // a forged header must not ask
+                                       // Argon2 for any cost it likes
+    span<uint8_t const> const salt(field += 8, crypto_pwhash_SALTBYTES);
+
+    Key const key = streamKey(password, salt, params);
+    crypto_secretstream_xchacha20poly1305_state state;
+    if (crypto_secretstream_xchacha20poly1305_init_pull(&state, 
+                            field + crypto_pwhash_SALTBYTES, key.data()) != 0)
+        throw runtime_error("Corrupt backup header");
+
+    vector<uint8_t> cipher(CHUNK_SIZE 
+                           + crypto_secretstream_xchacha20poly1305_ABYTES);
+    vector<uint8_t> chunk(CHUNK_SIZE);
+    size_t total = 0;
+    bool first = true;
+    for (unsigned char tag = 0; 
+            tag != crypto_secretstream_xchacha20poly1305_TAG_FINAL; 
+                first = false)
+    {
+        in.read(reinterpret_cast<char *>(cipher.data()), cipher.size());
+        size_t const size = in.gcount();
+        if (in.bad())
+            throw runtime_error("Reading the archive failed");
+        if (size < crypto_secretstream_xchacha20poly1305_ABYTES)
+            throw runtime_error("The backup is truncated");
+
+        unsigned long long chunkSize;
+        if (crypto_secretstream_xchacha20poly1305_pull(&state, chunk.data(),
+                &chunkSize, &tag, cipher.data(), size, 
+                first ? header.data() : nullptr, 
+                first ? header.size() : 0) != 0)
+            throw runtime_error(first ? "Wrong password or corrupt backup"
+                                      : "The backup is corrupt");
+
+        out.write(reinterpret_cast<char const *>(chunk.data()), chunkSize);
+        if (!out)
+            throw runtime_error("Writing the restored data failed");
+        total += chunkSize;
+    }
+
+    if (in.peek() != istream::traits_type::eof())
+        throw runtime_error("Unexpected data after the end of the backup");
+
+    sodium_memzero(&state, sizeof(state));
+    return total;
+}
@@ -0,0 +1,64 @@
+#include "archive.ih"
+
+namespace
+{
+    void putUint64(uint8_t *out, uint64_t value)
+    {
+        for (size_t idx = 0; idx != 8; ++idx, value >>= 8)
+            out[idx] = value & 0xff;
+    }
+}
+
+size_t Archive::seal(istream &in, ostream &out, string const &password,
+                     KdfParams const &params, 
+                     function<void(size_t)> const &progress)
+{
+    params.validate();
+
+    array<uint8_t, HEADER_SIZE> header;
+    uint8_t *field = header.data();
+    memcpy(field, MAGIC, MAGIC_SIZE);
+    putUint64(field += MAGIC_SIZE, params.opsLimit);
+    putUint64(field += 8, params.memLimit);
+    span<uint8_t> const salt(field += 8, crypto_pwhash_SALTBYTES);
+    randombytes_buf(salt.data(), salt.size());
+
+    Key const key = streamKey(password, salt, params);
+    crypto_secretstream_xchacha20poly1305_state state;
+    crypto_secretstream_xchacha20poly1305_init_push(&state, 
+                                        field + crypto_pwhash_SALTBYTES, 
+                                        key.data());
+    out.write(reinterpret_cast<char const *>(header.data()), header.size());
+
+    vector<uint8_t> chunk(CHUNK_SIZE);
+    vector<uint8_t> cipher(CHUNK_SIZE 
+                           + crypto_secretstream_xchacha20poly1305_ABYTES);
+    size_t total = 0;
+    bool first = true;
+    for (bool last = false; !last; first = false)
+    {
+        in.read(reinterpret_cast<char *>(chunk.data()), chunk.size());
+        size_t const size = in.gcount();
+        if (in.bad())
+            throw runtime_error("Reading the backup data failed");
+                                       // an empty final chunk is fine
+        last = in.eof() || in.peek() == istream::traits_type::eof();
+
+        unsigned long long cipherSize;  // the header is authenticated once
+        crypto_secretstream_xchacha20poly1305_push(&state, cipher.data(),
+                &cipherSize, chunk.data(), size, 
+                first ? header.data() : nullptr, first ? header.size() : 0,
+                last ? crypto_secretstream_xchacha20poly1305_TAG_FINAL
+                     : crypto_secretstream_xchacha20poly1305_TAG_MESSAGE);
+        out.write(reinterpret_cast<char const *>(cipher.data()), cipherSize);
+        if (!out)
+            throw runtime_error("Writing the archive failed");
+
+        total += size;
+        if (progress)
+            progress(total);
+    }
+
+    sodium_memzero(&state, sizeof(state));
+    return total;
+}
@@ -0,0 +1,12 @@
+#include "archive.ih"
+
+Key Archive::streamKey(string const &password, span<uint8_t const> salt,
+                       KdfParams const &params)
+{
+    static_assert(crypto_secretstream_xchacha20poly1305_KEYBYTES == 
+                  crypto_aead_xchacha20poly1305_ietf_KEYBYTES);
+    Key key;
+    params.derive({ key.data(), key.size() }, password, salt);
+    key.setValid(true);
+    return key;
+}
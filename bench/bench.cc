@@ -0,0 +1,80 @@
+#include "bench.ih"
+
+namespace
+{
+    enum
+    {
+        DEFAULT_ENTRIES = 1000,
+        MAX_SAMPLES = 1000,            // timed adds and gets per vault
+        GENERATED = 100'000            // passwords for the generator rate
+    };
+
+    int usage()
+    {
+        cerr << "usage: bench [--json] [--profile safe|balanced|fast] "
+                "[entries ...]\n";
+        return 2;
+    }
+}
+                                       // usage: see above
+int main(int argc, char *argv[])
+try
+{
+    if (sodium_init() < 0)
+        throw runtime_error("libsodium could not be initialized");
+
+    bool json = false;                 // every preset unless narrowed
+    vector<string> profiles(Durability::PRESETS.begin(), 
+                            Durability::PRESETS.end());
+    vector<size_t> sizes;
+    for (int idx = 1; idx != argc; ++idx)
+    {
+        string const arg = argv[idx];
+        if (arg == "--json")
+            json = true;
+        else if (arg == "--profile" && idx + 1 != argc)
+            profiles.assign(1, argv[++idx]);
+        else if (arg.find_first_not_of("0123456789") == string::npos)
+            sizes.push_back(stoul(arg));
+        else
+            return usage();
+    }
+    if (sizes.empty())
+        sizes.push_back(DEFAULT_ENTRIES);
+
+    vector<Durability> durabilities;   // all names checked before timing
+    for (string const &profile: profiles)
+        durabilities.push_back(Durability::preset(profile));
+
+    filesystem::path const directory = filesystem::temp_directory_path() 
+                        / ("cerberus-bench-" + to_string(randombytes_random()));
+    filesystem::create_directory(directory);
+
+    vector<ProfileResult> results;
+    for (size_t idx = 0; idx != profiles.size(); ++idx)
+    {
+        results.push_back({ profiles[idx], {} });
+        for (size_t const entries: sizes)
+        {
+            results.back().sizes.push_back(
+                        measure(directory / (to_string(entries) + ".db"),
+                                durabilities[idx], entries, 
+                                min<size_t>(max<size_t>(entries, 1),
+                                            MAX_SAMPLES)));
+            filesystem::remove_all(directory);  // one vault on disk at a 
+            filesystem::create_directory(directory);    // time
+        }
+    }
+    filesystem::remove_all(directory);
+
+    GeneratorRate const generator = measureGenerator(GENERATED);
+    if (json)
+        printJson(cout, generator, results);
+    else
+        printTable(cout, generator, results);
+}
+catch (exception const &ex)
+{
+    cerr << "Benchmark failed: " << ex.what() << '\n';
+    return 1;
+}
@@ -0,0 +1,102 @@
+#include "bench.ih"
+
+#include "../passwordPolicy/passwordPolicy.hh"
+
+namespace
+{
+    enum
+    {
+        FILL_CHUNK  = 10'000,          // entries per bulk-load transaction
+        UNLOCK_RUNS = 5
+    };
+
+    using Clock = chrono::steady_clock;
+
+    double microseconds(Clock::time_point start)
+    {
+        return chrono::duration<double, micro>(Clock::now() - start).count();
+    }
+
+    string website(size_t idx)
+    {
+        return "site" + to_string(idx) + ".example";
+    }
+
+    double fill(Vault &vault, size_t entries)
+    {
+        double seconds = 0;
+        for (size_t begin = 0; begin < entries; begin += FILL_CHUNK)
+        {                              // bounded memory for large vaults
+            size_t const count = min<size_t>(FILL_CHUNK, entries - begin);
+            vector<Secret> passwords = DefaultPolicy::generate(count);
+
+            vector<Credential> credentials;
+            credentials.reserve(count);
+            for (size_t idx = 0; idx != count; ++idx)
+                credentials.push_back({ website(begin + idx), "user",
+                                        move(passwords[idx]) });
+
+            auto const start = Clock::now();
+            vault.addMany(credentials);
+            seconds += microseconds(start) / 1e6;
+        }
+        return seconds > 0 ? entries / seconds : 0;
+    }
+}
+
+SizeResult measure(filesystem::path const &file, Durability const &profile, 
+                   size_t entries, size_t samples)
+{
+    SizeResult result{};
+    result.entries = entries;
+    {
+        Vault vault(file.string());
+        string master = "benchmark";
+        vault.initialize(master, BENCH_KDF);
+        vault.setDurability(profile);
+        result.fillRate = fill(vault, entries);
+        result.space = vault.spaceStats();  // before the timed adds: as
+    }                                       // many entries as reported
+
+    vector<double> times;
+    for (size_t run = 0; run != UNLOCK_RUNS; ++run)
+    {
+        auto const start = Clock::now();
+        Vault vault(file.string());
+        string master = "benchmark";
+        if (not vault.unlock(master))
+            throw runtime_error("The benchmark vault did not unlock");
+        times.push_back(microseconds(start));
+    }
+    result.unlockMs = percentiles(times).p50 / 1000;
+
+    Vault vault(file.string());
+    string master = "benchmark";
+    vault.unlock(master);
+
+    times.clear();                     // every add is its own transaction:
+    for (size_t idx = 0; idx != samples; ++idx)  // durability costs show
+    {
+        string const name = "new" + to_string(idx) + ".example";
+        auto const start = Clock::now();
+        vault.add<DefaultPolicy>(name, "user");
+        times.push_back(microseconds(start));
+    }
+    result.add = percentiles(times);
+
+    if (entries != 0)
+    {                                  // the zero-copy read path: one 
+        Secret buffer(DefaultPolicy::LENGTH);   // buffer for all gets
+        times.clear();
+        for (size_t idx = 0; idx != samples; ++idx)
+        {
+            string const name = website(randombytes_uniform(entries));
+            auto const start = Clock::now();
+            vault.get(name, "user", { buffer.buffer(), buffer.size() });
+            times.push_back(microseconds(start));
+        }
+        result.get = percentiles(times);
+    }
+
+    return result;
+}
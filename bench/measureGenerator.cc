@@ -0,0 +1,20 @@
+#include "bench.ih"
+
+#include "../passwordGenerator/passwordGenerator.hh"
+#include "../passwordPolicy/passwordPolicy.hh"
+
+GeneratorRate measureGenerator(size_t count)
+{
+    using Clock = chrono::steady_clock;
+
+    auto const runtimeStart = Clock::now();
+    PasswordGenerator{}.generate(PasswordGenerator::Policy{}, count);
+    chrono::duration<double> const runtime = Clock::now() - runtimeStart;
+
+    auto const compileTimeStart = Clock::now();
+    DefaultPolicy::generate(count);
+    chrono::duration<double> const compileTime = 
+                                            Clock::now() - compileTimeStart;
+
+    return { count / runtime.count(), count / compileTime.count() };
+}
@@ -0,0 +1,19 @@
+#include "bench.ih"
+
+#include <algorithm>
+#include <cmath>
+
+Latency percentiles(vector<double> &microseconds)
+{
+    if (microseconds.empty())
+        return { 0, 0 };
+
+    ranges::sort(microseconds);
+    auto const rank = [&](double fraction)     // nearest-rank method
+                      {
+                          size_t const idx = ceil(fraction * 
+                                                  microseconds.size());
+                          return microseconds[max<size_t>(idx, 1) - 1];
+                      };
+    return { rank(.50), rank(.99) };
+}
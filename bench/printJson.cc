@@ -0,0 +1,66 @@
+#include "bench.ih"
+
+namespace
+{
+    char const HEX[] = "0123456789abcdef";
+
+    void printLatency(ostream &out, char const *name, Latency const &latency)
+    {
+        out << '"' << name << "_p50_us\": " << latency.p50 << ", "
+            << '"' << name << "_p99_us\": " << latency.p99;
+    }
+
+    void printString(ostream &out, string const &text)
+    {
+        out << '"';
+        for (unsigned char ch: text)
+        {
+            if (ch == '"' || ch == '\\')
+                out << '\\' << ch;
+            else if (ch < 0x20)        // control characters: \u00XX
+                out << "\\u00" << HEX[ch >> 4] << HEX[ch & 15];
+            else
+                out << ch;
+        }
+        out << '"';
+    }
+}
+
+void printJson(ostream &out, GeneratorRate const &generator, 
+               vector<ProfileResult> const &results)
+{
+    out << fixed << setprecision(3)
+        << "{\n"
+           "  \"kdf\": { \"opslimit\": " << BENCH_KDF.opsLimit 
+        << ", \"memlimit\": " << BENCH_KDF.memLimit << " },\n"
+           "  \"generator_per_s\": { \"runtime\": " << generator.runtime
+        << ", \"constexpr\": " << generator.compileTime << " },\n"
+           "  \"profiles\": [";
+
+    char const *profileSeparator = "\n";
+    for (ProfileResult const &profile: results)
+    {
+        out << profileSeparator << "    { \"profile\": ";
+        printString(out, profile.profile);
+        out << ", \"sizes\": [";
+
+        char const *separator = "\n";
+        for (SizeResult const &result: profile.sizes)
+        {
+            out << separator 
+                << "      { \"entries\": " << result.entries 
+                << ", \"fill_per_s\": " << result.fillRate
+                << ", \"unlock_ms\": " << result.unlockMs << ", ";
+            printLatency(out, "add", result.add);
+            out << ", ";
+            printLatency(out, "get", result.get);
+            out << ", \"file_bytes\": " << result.space.fileSize()
+                << ", \"bytes_per_entry\": " << result.space.bytesPerEntry() 
+                << " }";
+            separator = ",\n";
+        }
+        out << "\n    ] }";
+        profileSeparator = ",\n";
+    }
+    out << "\n  ]\n}\n";
+}
@@ -0,0 +1,32 @@
+#include "bench.ih"
+
+void printTable(ostream &out, GeneratorRate const &generator, 
+                vector<ProfileResult> const &results)
+{
+    out << "kdf " << BENCH_KDF << '\n'
+        << fixed << setprecision(0)
+        << "generator: " << generator.runtime << " passwords/s (runtime "
+           "policy), " << generator.compileTime << " passwords/s "
+           "(DefaultPolicy)\n";
+
+    for (ProfileResult const &profile: results)
+    {
+        out << "\nprofile " << profile.profile << '\n'
+            << right << setw(10) << "entries" << setw(11) << "fill/s"
+            << setw(11) << "unlock ms" 
+            << setw(10) << "add p50" << setw(10) << "add p99"
+            << setw(10) << "get p50" << setw(10) << "get p99"
+            << setw(12) << "file bytes" << setw(11) << "B/entry" << '\n';
+
+        for (SizeResult const &result: profile.sizes)
+            out << setw(10) << result.entries << setw(11) << result.fillRate
+                << setw(11) << setprecision(1) << result.unlockMs 
+                << setw(10) << result.add.p50 << setw(10) << result.add.p99 
+                << setw(10) << result.get.p50 << setw(10) << result.get.p99
+                << setprecision(0)
+                << setw(12) << result.space.fileSize() 
+                << setw(11) << result.space.bytesPerEntry() << endl;
+    }
+
+    out << "(latencies in microseconds)\n";
+}
@@ -0,0 +1,7 @@
+#include "breachIndex.ih"
+
+size_t BreachIndex::block(unsigned char const *hash) const
+{
+    return static_cast<unsigned __int128>(prefix(hash)) * d_blocks >> 64
+           << BLOCK_SHIFT;
+}
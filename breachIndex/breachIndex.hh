@@ -0,0 +1,121 @@
+#ifndef INCLUDED_BREACHINDEX_
+#define INCLUDED_BREACHINDEX_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * \brief Offline corpus of breached passwords: a memory-mapped, sorted
+ *        file of password hashes behind an in-memory Bloom filter.
+ *
+ * The corpus file is a plain array of HASH_SIZE-byte hashes (unkeyed
+ * BLAKE2b-160 of each breached password), sorted bytewise, without
+ * duplicates; `create` writes one from a list of passwords. 
+ *
+ * Opening maps the file and reads it once, on all cores, checking its
+ * order while filling a blocked Bloom filter of BITS_PER_HASH bits per
+ * hash: each hash sets PROBES bits within one 64-byte block, so a query
+ * costs a single cache miss. Most passwords that are not in the corpus are
+ * rejected there without touching the file. For the others the search
+ * starts at the position the hash's leading bytes predict (the hashes are
+ * uniform), gallops to bracket it and binary-searches the bracket, which
+ * touches a page or two of the file.
+ *
+ * Lookups are const and thread-safe.
+ */
+class BreachIndex
+{
+    public:
+        enum
+        {
+            HASH_SIZE     = 20,        // BLAKE2b-160
+            BITS_PER_HASH = 10,        // of the filter: ~1% false positives
+            PROBES        = 7,         // filter bits set by a hash
+            BLOCK_SHIFT   = 3,         // a filter block: 8 64-bit words
+            BLOCK_WORDS   = 1 << BLOCK_SHIFT,
+            SCAN_CHUNK    = 1 << 20    // hashes per task when opening
+        };
+
+        using Hash = std::array<std::uint8_t, HASH_SIZE>;
+
+    private:
+        unsigned char const *d_data = nullptr;  // the mapped file
+        std::size_t d_count;           // hashes in it
+        std::size_t d_blocks;          // of the filter
+        std::vector<std::uint64_t> d_filter;
+
+    public:
+        /**
+         * Map the corpus `filename` and fill its filter, using at most
+         * `filterBytes` of memory (0: BITS_PER_HASH bits per hash) and 
+         * `threads` threads (0: hardware concurrency).
+         * \throws std::runtime_error if the file cannot be mapped, is not a
+         *         whole number of hashes or is not sorted.
+         */
+        explicit BreachIndex(std::string const &filename,
+                             std::size_t filterBytes = 0, 
+                             std::size_t threads = 0);
+
+        BreachIndex(BreachIndex const &other) = delete;
+        BreachIndex &operator=(BreachIndex const &other) = delete;
+
+        ~BreachIndex();
+
+        /** Number of hashes in the corpus.*/
+        std::size_t size() const;
+
+        /** True if `password` is in the corpus.*/
+        bool contains(std::string_view password) const;
+
+        /** True if `hash` is in the corpus.*/
+        bool contains(Hash const &hash) const;
+
+        /** The corpus hash of `password`.*/
+        static Hash hashOf(std::string_view password);
+
+        /**
+         * Write the corpus of the passwords in `passwords`, one per line
+         * (empty lines are skipped), to `filename`, which is replaced once
+         * it is complete. Sorting takes HASH_SIZE bytes of memory per 
+         * password.
+         * \returns the number of distinct hashes.
+         * \throws std::runtime_error if the file cannot be written.
+         */
+        static std::size_t create(std::istream &passwords, 
+                                  std::string const &filename);
+
+    private:
+        /** The `idx`-th hash of the file.*/
+        unsigned char const *record(std::size_t idx) const;
+
+        /** Offset in `d_filter` of the block of `hash`: its leading 
+         *  bytes, scaled, so sorted hashes fill the filter front to back.*/
+        std::size_t block(unsigned char const *hash) const;
+
+        /** The PROBES bits of `hash` within its block.*/
+        static std::array<std::uint64_t, BLOCK_WORDS> 
+                                        probes(unsigned char const *hash);
+
+        /** False if the filter rules `hash` out.*/
+        bool mayContain(unsigned char const *hash) const;
+
+        /** Set the filter bits of `hash`; safe from several threads.*/
+        void mark(unsigned char const *hash);
+
+        /** Mark hashes [begin, end), checking that they ascend.*/
+        void scan(std::size_t begin, std::size_t end);
+
+        /** True if the file holds `hash` (interpolate, gallop, bisect).*/
+        bool find(unsigned char const *hash) const;
+
+        /** The first 8 bytes of `hash`, big-endian: its rank in
+         *  [0, 2^64).*/
+        static std::uint64_t prefix(unsigned char const *hash);
+};
+
+#endif
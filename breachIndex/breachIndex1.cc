@@ -0,0 +1,61 @@
+#include "breachIndex.ih"
+
+BreachIndex::BreachIndex(string const &filename, size_t filterBytes,
+                         size_t threads)
+{
+    int const fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        throw runtime_error("Cannot open " + filename + ": " 
+                            + strerror(errno));
+
+    struct stat status;
+    if (fstat(fd, &status) != 0 || status.st_size % HASH_SIZE != 0)
+    {
+        ::close(fd);
+        throw runtime_error(filename + " is not a breach corpus");
+    }
+
+    d_count = status.st_size / HASH_SIZE;
+    if (d_count != 0)
+    {
+        void *data = mmap(nullptr, status.st_size, PROT_READ, MAP_SHARED, 
+                          fd, 0);
+        if (data == MAP_FAILED)
+        {
+            ::close(fd);
+            throw runtime_error("Cannot map " + filename + ": " 
+                                + strerror(errno));
+        }
+        d_data = static_cast<unsigned char const *>(data);
+    }
+    ::close(fd);                       // the mapping keeps the file
+
+    try
+    {
+        size_t bits = BITS_PER_HASH * d_count;
+        if (filterBytes != 0)
+            bits = min(bits, 8 * filterBytes);
+        d_blocks = max<size_t>(1, bits / (64 * BLOCK_WORDS));
+        d_filter.resize(d_blocks * BLOCK_WORDS);
+
+        if (d_count == 0)
+            return;
+                                       // read once, front to back
+        madvise(const_cast<unsigned char *>(d_data), status.st_size, 
+                MADV_SEQUENTIAL);
+        WorkerPool pool(threads);
+        pool.run((d_count + SCAN_CHUNK - 1) / SCAN_CHUNK, [&](size_t chunk)
+        {
+            scan(chunk * SCAN_CHUNK, 
+                 min<size_t>(d_count, (chunk + 1) * SCAN_CHUNK));
+        });
+    }
+    catch (...)
+    {
+        if (d_data != nullptr)
+            munmap(const_cast<unsigned char *>(d_data), status.st_size);
+        throw;
+    }
+                                       // then only searched
+    madvise(const_cast<unsigned char *>(d_data), status.st_size, MADV_RANDOM);
+}
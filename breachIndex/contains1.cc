@@ -0,0 +1,6 @@
+#include "breachIndex.ih"
+
+bool BreachIndex::contains(string_view password) const
+{
+    return contains(hashOf(password));
+}
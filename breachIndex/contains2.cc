@@ -0,0 +1,6 @@
+#include "breachIndex.ih"
+
+bool BreachIndex::contains(Hash const &hash) const
+{
+    return d_count != 0 && mayContain(hash.data()) && find(hash.data());
+}
@@ -0,0 +1,30 @@
+#include "breachIndex.ih"
+
+size_t BreachIndex::create(istream &passwords, string const &filename)
+{
+    vector<Hash> hashes;
+    for (string line; getline(passwords, line); )
+    {
+        if (not line.empty() && line.back() == '\r')
+            line.pop_back();           // CRLF lists
+        if (not line.empty())
+            hashes.push_back(hashOf(line));
+    }
+
+    ranges::sort(hashes);              // bytewise, as memcmp
+    hashes.erase(ranges::unique(hashes).begin(), hashes.end());
+
+    string const part = filename + ".part";
+    {
+        ofstream out(part, ios::binary | ios::trunc);
+        out.write(reinterpret_cast<char const *>(hashes.data()), 
+                  hashes.size() * HASH_SIZE);
+        if (!out.flush())
+        {
+            filesystem::remove(part);
+            throw runtime_error("Cannot write " + part);
+        }
+    }
+    filesystem::rename(part, filename);
+    return hashes.size();
+}
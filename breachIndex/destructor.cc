@@ -0,0 +1,7 @@
+#include "breachIndex.ih"
+
+BreachIndex::~BreachIndex()
+{
+    if (d_data != nullptr)
+        munmap(const_cast<unsigned char *>(d_data), d_count * HASH_SIZE);
+}
@@ -0,0 +1,53 @@
+#include "breachIndex.ih"
+
+bool BreachIndex::find(unsigned char const *hash) const
+{
+    auto const before = [&](size_t idx)
+    {
+        return memcmp(record(idx), hash, HASH_SIZE) < 0;
+    };
+                                       // where a uniform hash should be
+    size_t const guess = static_cast<unsigned __int128>(prefix(hash)) 
+                         * d_count >> 64;
+                                       // the first hash not before `hash`
+    size_t lo = 0;                     // is in [lo, hi]
+    size_t hi = d_count;
+    if (before(guess))                 // gallop from the guess
+    {
+        lo = guess + 1;
+        for (size_t step = 1; lo + step - 1 < hi; step *= 2)
+        {
+            size_t const probe = lo + step - 1;
+            if (not before(probe))
+            {
+                hi = probe;
+                break;
+            }
+            lo = probe + 1;
+        }
+    }
+    else
+    {
+        hi = guess;
+        for (size_t step = 1; step <= hi - lo; step *= 2)
+        {
+            size_t const probe = hi - step;
+            if (before(probe))
+            {
+                lo = probe + 1;
+                break;
+            }
+            hi = probe;
+        }
+    }
+
+    while (lo < hi)                    // and bisect the bracket
+    {
+        size_t const mid = lo + (hi - lo) / 2;
+        if (before(mid))
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo != d_count && memcmp(record(lo), hash, HASH_SIZE) == 0;
+}
@@ -0,0 +1,11 @@
+#include "breachIndex.ih"
+
+BreachIndex::Hash BreachIndex::hashOf(string_view password)
+{
+    Hash hash;
+    crypto_generichash(hash.data(), hash.size(), 
+                       reinterpret_cast<unsigned char const *>(
+                                                        password.data()),
+                       password.size(), nullptr, 0);
+    return hash;
+}
@@ -0,0 +1,12 @@
+#include "breachIndex.ih"
+
+void BreachIndex::mark(unsigned char const *hash)
+{
+    uint64_t *words = d_filter.data() + block(hash);
+    auto const mask = probes(hash);
+                                       // neighbouring chunks may share a
+    for (size_t idx = 0; idx != BLOCK_WORDS; ++idx)   // block
+        if (mask[idx] != 0)
+            atomic_ref(words[idx]).fetch_or(mask[idx], 
+                                            memory_order_relaxed);
+}
@@ -0,0 +1,12 @@
+#include "breachIndex.ih"
+
+bool BreachIndex::mayContain(unsigned char const *hash) const
+{
+    uint64_t const *words = d_filter.data() + block(hash);
+    auto const mask = probes(hash);
+
+    for (size_t idx = 0; idx != BLOCK_WORDS; ++idx)
+        if ((words[idx] & mask[idx]) != mask[idx])
+            return false;
+    return true;
+}
@@ -0,0 +1,8 @@
+#include "breachIndex.ih"
+
+uint64_t BreachIndex::prefix(unsigned char const *hash)
+{
+    uint64_t value;
+    memcpy(&value, hash, sizeof value);
+    return endian::native == endian::little ? byteswap(value) : value;
+}
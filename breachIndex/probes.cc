@@ -0,0 +1,16 @@
+#include "breachIndex.ih"
+
+array<uint64_t, BreachIndex::BLOCK_WORDS> BreachIndex::probes(
+                                                    unsigned char const *hash)
+{
+    uint64_t bits;                     // bytes the block does not use
+    memcpy(&bits, hash + 8, sizeof bits);
+
+    array<uint64_t, BLOCK_WORDS> mask{};
+    for (size_t probe = 0; probe != PROBES; ++probe, bits >>= 9)
+    {                                  // 9 bits: one of 512
+        unsigned const bit = bits & 511;
+        mask[bit >> 6] |= uint64_t{ 1 } << (bit & 63);
+    }
+    return mask;
+}
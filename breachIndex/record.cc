@@ -0,0 +1,6 @@
+#include "breachIndex.ih"
+
+unsigned char const *BreachIndex::record(size_t idx) const
+{
+    return d_data + idx * HASH_SIZE;
+}
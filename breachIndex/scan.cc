@@ -0,0 +1,13 @@
+#include "breachIndex.ih"
+
+void BreachIndex::scan(size_t begin, size_t end)
+{
+    for (size_t idx = begin; idx != end; ++idx)
+    {                                  // also across chunk boundaries
+        if (idx != 0 && memcmp(record(idx - 1), record(idx), HASH_SIZE) >= 0)
+            throw runtime_error("The breach corpus is not sorted or has "
+                                "duplicates (at hash " + to_string(idx) 
+                                + ')');
+        mark(record(idx));
+    }
+}
@@ -0,0 +1,6 @@
+#include "breachIndex.ih"
+
+size_t BreachIndex::size() const
+{
+    return d_count;
+}
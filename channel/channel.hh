@@ -0,0 +1,68 @@
+#ifndef INCLUDED_CHANNEL_
+#define INCLUDED_CHANNEL_
+
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * \brief Framed message exchange over a connected stream socket.
+ *
+ * Used between the agent and its clients. A message is a one-byte code
+ * followed by a list of byte-string fields; on the wire:
+ *
+ *     u32 payload length | code | (u32 field length | field bytes)*
+ *
+ * with lengths in network byte order. Payloads larger than `MAX_PAYLOAD`
+ * are rejected. Buffers that carried a message are wiped, as they may hold
+ * passwords. The socket is closed by the destructor.
+ */
+class Channel
+{
+    int d_fd;
+
+    public:
+        enum
+        {
+            MAX_PAYLOAD = 1 << 16
+        };
+
+        /** Take ownership of the connected socket `fd`. */
+        explicit Channel(int fd);
+
+        Channel(Channel const &other) = delete;
+        Channel(Channel &&tmp) noexcept;
+
+        Channel &operator=(Channel const &other) = delete;
+
+        ~Channel();
+
+        /** Connect to the Unix domain socket at `path`.
+         *  \throws std::runtime_error if nobody listens there.*/
+        static Channel connect(std::string const &path);
+
+        /** True if a message whose fields have the sizes `fieldSizes`
+         *  fits in MAX_PAYLOAD. */
+        static bool fits(std::initializer_list<size_t> fieldSizes);
+
+        /** Send one message.
+         *  \throws std::runtime_error if the peer went away.*/
+        void send(char code, std::vector<std::string_view> const &fields);
+
+        /**
+         * Receive one message into `code` and `fields`. Returns false if the
+         * peer closed the connection between messages.
+         * \throws std::runtime_error on a malformed, oversized or truncated
+         *         message, or on a receive timeout.
+         */
+        bool receive(char &code, std::vector<std::string> &fields);
+
+    private:
+        /** Read exactly `size` bytes; false on end-of-file before the first.*/
+        bool readAll(void *data, size_t size);
+        void writeAll(void const *data, size_t size);
+};
+
+#endif
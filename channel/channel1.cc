@@ -0,0 +1,6 @@
+#include "channel.ih"
+
+Channel::Channel(int fd)
+:
+    d_fd(fd)
+{}
@@ -0,0 +1,6 @@
+#include "channel.ih"
+
+Channel::Channel(Channel &&tmp) noexcept
+:
+    d_fd(exchange(tmp.d_fd, -1))
+{}
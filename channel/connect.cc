@@ -0,0 +1,22 @@
+#include "channel.ih"
+                                       // static
+Channel Channel::connect(string const &path)
+{
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof address.sun_path)
+        throw runtime_error("Agent socket path too long: " + path);
+    memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+    int const fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+        throw runtime_error("socket: "s + strerror(errno));
+
+    Channel channel(fd);               // closes fd if connecting fails
+    if (::connect(fd, reinterpret_cast<sockaddr *>(&address), 
+                  sizeof address) != 0)
+        throw runtime_error("No agent listening on " + path + ": " 
+                            + strerror(errno));
+
+    return channel;
+}
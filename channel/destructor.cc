@@ -0,0 +1,7 @@
+#include "channel.ih"
+
+Channel::~Channel()
+{
+    if (d_fd >= 0)
+        close(d_fd);
+}
@@ -0,0 +1,9 @@
+#include "channel.ih"
+
+bool Channel::fits(initializer_list<size_t> fieldSizes)
+{
+    size_t payload = 1;                // the code
+    for (size_t size: fieldSizes)
+        payload += sizeof(uint32_t) + size;
+    return payload <= MAX_PAYLOAD;
+}
@@ -0,0 +1,24 @@
+#include "channel.ih"
+
+bool Channel::readAll(void *data, size_t size)
+{
+    auto *dest = static_cast<char *>(data);
+    for (size_t done = 0; done != size; )
+    {
+        ssize_t const got = recv(d_fd, dest + done, size - done, 0);
+        if (got > 0)
+        {
+            done += got;
+            continue;
+        }
+        if (got == 0 && done == 0)
+            return false;              // orderly close
+        if (got < 0 && errno == EINTR)
+            continue;
+
+        throw runtime_error(got == 0 ? "Connection closed mid-message"s
+                                     : "recv: "s + strerror(errno));
+    }
+
+    return true;
+}
@@ -0,0 +1,44 @@
+#include "channel.ih"
+
+bool Channel::receive(char &code, vector<string> &fields)
+{
+    uint32_t net;
+    if (!readAll(&net, sizeof net))
+        return false;
+
+    size_t const payload = ntohl(net);
+    if (payload == 0 || payload > MAX_PAYLOAD)
+        throw runtime_error("Malformed message length");
+
+    string frame(payload, '\0');
+    if (!readAll(frame.data(), frame.size()))
+    {                                  // closed right after the length
+        sodium_memzero(frame.data(), frame.size());
+        throw runtime_error("Connection closed mid-message");
+    }
+
+    code = frame.front();
+    fields.clear();
+    for (size_t pos = 1; pos != frame.size(); )
+    {
+        if (frame.size() - pos < sizeof net)
+        {
+            sodium_memzero(frame.data(), frame.size());
+            throw runtime_error("Malformed message field");
+        }
+        memcpy(&net, frame.data() + pos, sizeof net);
+        pos += sizeof net;
+
+        size_t const length = ntohl(net);
+        if (length > frame.size() - pos)
+        {
+            sodium_memzero(frame.data(), frame.size());
+            throw runtime_error("Malformed message field");
+        }
+        fields.emplace_back(frame, pos, length);
+        pos += length;
+    }
+
+    sodium_memzero(frame.data(), frame.size());
+    return true;
+}
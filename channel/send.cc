@@ -0,0 +1,33 @@
+#include "channel.ih"
+
+namespace
+{
+    void appendLength(string &frame, size_t length)
+    {
+        uint32_t const net = htonl(static_cast<uint32_t>(length));
+        frame.append(reinterpret_cast<char const *>(&net), sizeof net);
+    }
+}
+
+void Channel::send(char code, vector<string_view> const &fields)
+{
+    size_t payload = 1;
+    for (string_view field: fields)
+        payload += sizeof(uint32_t) + field.size();
+
+    if (payload > MAX_PAYLOAD)
+        throw runtime_error("Message too large");
+
+    string frame;                      // one write per message
+    frame.reserve(sizeof(uint32_t) + payload);
+    appendLength(frame, payload);
+    frame.push_back(code);
+    for (string_view field: fields)
+    {
+        appendLength(frame, field.size());
+        frame.append(field);
+    }
+
+    writeAll(frame.data(), frame.size());
+    sodium_memzero(frame.data(), frame.size());
+}
@@ -0,0 +1,18 @@
+#include "channel.ih"
+
+void Channel::writeAll(void const *data, size_t size)
+{
+    auto const *src = static_cast<char const *>(data);
+    for (size_t done = 0; done != size; )
+    {                                  // no SIGPIPE if the peer is gone
+        ssize_t const sent = ::send(d_fd, src + done, size - done, 
+                                    MSG_NOSIGNAL);
+        if (sent < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            throw runtime_error("send: "s + strerror(errno));
+        }
+        done += sent;
+    }
+}
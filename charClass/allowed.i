@@ -0,0 +1,4 @@
+inline constexpr bool CharClass::allowed(char ch, bool noLookAlikes)
+{
+    return not (noLookAlikes and LOOK_ALIKES.contains(ch));
+}
@@ -0,0 +1,13 @@
+template <size_t N>
+constexpr std::array<char, N> CharClass::alphabet(unsigned classes,
+                                                  bool noLookAlikes)
+{
+    std::array<char, N> chars{};
+    size_t count = 0;
+    for (size_t type = 0; type != COUNT; ++type)
+        if (classes & (1u << type))
+            for (char ch: SETS[type])
+                if (allowed(ch, noLookAlikes))
+                    chars[count++] = ch;
+    return chars;
+}
@@ -0,0 +1,83 @@
+#ifndef INCLUDED_CHARCLASS_
+#define INCLUDED_CHARCLASS_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * \brief Character classes of generated passwords and the constexpr tables
+ *        built from them.
+ *
+ * A set of classes is a bitmask of `Flag`s. The table builders let
+ * `PasswordPolicy` compute its alphabet, membership and sampling tables
+ * at compile time.
+ */
+struct CharClass
+{
+    enum Flag: unsigned
+    {
+        LOWER   = 1,
+        UPPER   = 2,
+        DIGITS  = 4,
+        SYMBOLS = 8,
+        ALL     = 15
+    };
+
+    enum
+    {
+        COUNT = 4                      // number of classes
+    };
+
+    static constexpr std::string_view SETS[COUNT] =
+    {
+        "abcdefghijklmnopqrstuvwxyz",
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZ",
+        "0123456789",
+        "!@#$%^&*()-_=+[]{};:,.<>?/"
+    };
+                                       // left out on request
+    static constexpr std::string_view LOOK_ALIKES = "0Oo1lI";
+
+                                       // byte -> character, '\0': rejected
+    using Sampler = std::array<char, 256>;
+
+    /** Number of characters in `classes`. */
+    static constexpr size_t size(unsigned classes, bool noLookAlikes);
+
+    /** The characters of `classes`, in class order; N == size(...). */
+    template <size_t N>
+    static constexpr std::array<char, N> alphabet(unsigned classes, 
+                                                  bool noLookAlikes);
+
+    /** The class `Flag` of every byte value, 0 if not in `classes`. */
+    static constexpr std::array<uint8_t, 256> membership(unsigned classes,
+                                                         bool noLookAlikes);
+
+    /**
+     * Maps a uniform random byte to a uniform character of `classes`:
+     * bytes below the largest multiple of the alphabet size map to
+     * `alphabet[byte % size]`, the others to '\0' (draw again).
+     */
+    static constexpr Sampler sampler(unsigned classes, bool noLookAlikes);
+
+    /**
+     * For every bound in [1, N]: the largest multiple of the bound not 
+     * exceeding 256, below which a random byte modulo the bound is uniform.
+     */
+    template <size_t N>
+    static constexpr std::array<uint16_t, N + 1> limits();
+
+    private:
+        static constexpr bool allowed(char ch, bool noLookAlikes);
+};
+
+#include "allowed.i"
+#include "size.i"
+#include "alphabet.i"
+#include "membership.i"
+#include "sampler.i"
+#include "limits.i"
+
+#endif
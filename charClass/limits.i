@@ -0,0 +1,8 @@
+template <size_t N>
+constexpr std::array<uint16_t, N + 1> CharClass::limits()
+{
+    std::array<uint16_t, N + 1> table{};
+    for (size_t bound = 1; bound <= N; ++bound)
+        table[bound] = 256 - 256 % bound;
+    return table;
+}
@@ -0,0 +1,11 @@
+inline constexpr std::array<uint8_t, 256> CharClass::membership(
+                                        unsigned classes, bool noLookAlikes)
+{
+    std::array<uint8_t, 256> table{};
+    for (size_t type = 0; type != COUNT; ++type)
+        if (classes & (1u << type))
+            for (char ch: SETS[type])
+                if (allowed(ch, noLookAlikes))
+                    table[static_cast<unsigned char>(ch)] = 1u << type;
+    return table;
+}
@@ -0,0 +1,13 @@
+inline constexpr CharClass::Sampler CharClass::sampler(unsigned classes,
+                                                       bool noLookAlikes)
+{
+    Sampler table{};
+    size_t const count = size(classes, noLookAlikes);
+    if (count == 0)
+        return table;
+                                       // the alphabet, padded
+    std::array<char, 256> const chars = alphabet<256>(classes, noLookAlikes);
+    for (size_t byte = 0; byte != 256 - 256 % count; ++byte)
+        table[byte] = chars[byte % count];
+    return table;
+}
@@ -0,0 +1,9 @@
+inline constexpr size_t CharClass::size(unsigned classes, bool noLookAlikes)
+{
+    size_t count = 0;
+    for (size_t type = 0; type != COUNT; ++type)
+        if (classes & (1u << type))
+            for (char ch: SETS[type])
+                count += allowed(ch, noLookAlikes);
+    return count;
+}
@@ -1,13 +1,5 @@
 #include "main.ih"
 
-namespace
-{
-    enum
-    {
-        PASSWORD_LENGTH = 20
-    };
-}
-
 void cmdAdd(Vault &vault)
 {
     string website = IOTools::promptLine("Website: ");
@@ -19,7 +11,20 @@ void cmdAdd(Vault &vault)
         return;
     }
 
-    Secret const password = vault.add(website, userId, PASSWORD_LENGTH);
-    cout << "Generated password: " << password.data() << '\n';
-    cout << "✓ Stored / updated credential.\n";
-}
\ No newline at end of file
+    string const spec = IOTools::promptLine("Password policy (LENGTH [luds] "
+                                            "[x], empty: " + 
+                                            to_string(DefaultPolicy::LENGTH) +
+                                            " luds): ");
+    try
+    {
+        Secret const password = spec.empty() ? 
+            vault.add<DefaultPolicy>(website, userId) :
+            vault.add(website, userId, PasswordGenerator::Policy::parse(spec));
+        cout << "Generated password: " << password.data() << '\n';
+        cout << "✓ Stored / updated credential.\n";
+    }
+    catch (exception const &ex)        // a bad policy, every password in
+    {                                  // the breach corpus, a DB error
+        cout << ex.what() << "\nNothing stored.\n";
+    }
+}
@@ -0,0 +1,31 @@
+#include "main.ih"
+
+void cmdAudit(Vault &vault)
+{
+    char const *corpus = getenv("CERBERUS_BREACH_CORPUS");
+    if (corpus == nullptr || *corpus == 0)
+    {                                  // the check loadBreaches makes
+        cout << "No breach corpus is set. Set CERBERUS_BREACH_CORPUS to a "
+                "corpus file (see `main breach-corpus`).\n";
+        return;
+    }
+
+    try
+    {
+        auto const start = chrono::steady_clock::now();
+        auto const breached = vault.audit();
+        chrono::duration<double> const seconds = chrono::steady_clock::now()
+                                                 - start;
+
+        for (auto const &[website, userIdentifier]: breached)
+            cout << website << '\t' << userIdentifier << '\n';
+        cout << breached.size() << " breached passwords (checked in " 
+             << seconds.count() << " s).\n";
+        if (not breached.empty())
+            cout << "Replace them with `add`.\n";
+    }
+    catch (exception const &ex)        // e.g. a corpus that did not load
+    {
+        cout << "Audit failed: " << ex.what() << '\n';
+    }
+}
@@ -0,0 +1,41 @@
+#include "main.ih"
+
+void cmdBackup(Vault &vault)
+{
+    string const path = IOTools::promptLine("Back up to file: ");
+    if (path.empty())
+    {
+        cout << "Nothing backed up (no file).\n";
+        return;
+    }
+
+    try
+    {                                  // prompt twice to avoid typos
+        string password = IOTools::hiddenPrompt("Backup password: ");
+        string confirm = IOTools::hiddenPrompt("Confirm backup password: ");
+        bool const match = password == confirm;
+        sodium_memzero(confirm.data(), confirm.size());
+        if (!match)
+        {
+            sodium_memzero(password.data(), password.size());
+            throw runtime_error("passwords don't match");
+        }
+
+        auto const start = chrono::steady_clock::now();
+        size_t const pages = vault.backup(path, password, 64,
+            [](size_t done, size_t total)
+            {
+                cout << "\rCopied " << done << " / " << total << " pages"
+                     << flush;
+            });
+        chrono::duration<double> const elapsed = 
+                                        chrono::steady_clock::now() - start;
+
+        cout << "\n✓ Backed up " << pages << " pages to " << path << " in " 
+             << elapsed.count() << " s.\n";
+    }
+    catch (exception const &ex)
+    {
+        cout << "\nBackup failed: " << ex.what() << '\n';
+    }
+}
@@ -0,0 +1,24 @@
+#include "main.ih"
+
+void cmdBlind(Vault &vault)
+{
+    bool const blinded = vault.blinded();
+    cout << "Website and user names are stored " 
+         << (blinded ? "encrypted" : "in plaintext") << ".\n";
+
+    string const answer = IOTools::promptLine(blinded 
+                                ? "Store them in plaintext? [y/N] "
+                                : "Encrypt them? [y/N] ");
+    if (answer != "y" && answer != "Y")
+        return;
+
+    try
+    {
+        size_t const count = vault.setBlinded(!blinded);
+        cout << "✓ Rewrote " << count << " entries.\n";
+    }
+    catch (exception const &ex)
+    {
+        cout << "Vault not converted: " << ex.what() << '\n';
+    }
+}
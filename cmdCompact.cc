@@ -0,0 +1,14 @@
+#include "main.ih"
+
+void cmdCompact(Vault &vault)
+{
+    cout << "Before: " << vault.spaceStats() << '\n';
+
+    auto const start = chrono::steady_clock::now();
+    SpaceStats const after = vault.compact();
+    chrono::duration<double> const seconds = chrono::steady_clock::now() 
+                                             - start;
+
+    cout << "After:  " << after << '\n'
+         << "✓ Compacted in " << seconds.count() << " s.\n";
+}
@@ -0,0 +1,45 @@
+#include "main.ih"
+
+namespace
+{
+    string ask(string const &label, string const &current)
+    {                                  // an empty answer keeps `current`
+        string const answer = IOTools::promptLine(label + " (" + current + "): ");
+        return answer.empty() ? current : answer;
+    }
+}
+
+void cmdDurability(Vault &vault)
+{
+    Durability profile = vault.durability();
+    cout << "Current: " << profile << '\n';
+
+    string const name = IOTools::promptLine(
+                        "Profile [safe|balanced|fast|custom] (keep current): ");
+    if (name.empty())
+        return;
+
+    try
+    {
+        if (name != "custom")
+            profile = Durability::preset(name);
+        else
+        {
+            profile.journalMode = ask("journal_mode", profile.journalMode);
+            profile.synchronous = ask("synchronous", profile.synchronous);
+            profile.mmapSize  = stoll(ask("mmap_size", 
+                                          to_string(profile.mmapSize)));
+            profile.cacheSize = stoll(ask("cache_size", 
+                                          to_string(profile.cacheSize)));
+            profile.pageSize  = stoll(ask("page_size", 
+                                          to_string(profile.pageSize)));
+        }
+
+        vault.setDurability(profile);
+        cout << "✓ Now using: " << vault.durability() << '\n';
+    }
+    catch (exception const &ex)
+    {
+        cout << "Profile not changed: " << ex.what() << '\n';
+    }
+}
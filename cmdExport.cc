@@ -0,0 +1,69 @@
+#include "main.ih"
+
+namespace
+{
+    void writeField(ostream &out, string_view field)
+    {
+        if (field.find_first_of(",\"\r\n") == string_view::npos)
+        {
+            out << field;
+            return;
+        }
+
+        out << '"';                    // RFC 4180 quoting, as read by import
+        for (char ch: field)
+        {
+            if (ch == '"')
+                out << '"';
+            out << ch;
+        }
+        out << '"';
+    }
+}
+
+void cmdExport(Vault &vault)
+{
+    string const path = IOTools::promptLine("Export to file: ");
+    if (path.empty())
+    {
+        cout << "Nothing exported (no file).\n";
+        return;
+    }
+
+    try
+    {
+                                       // plaintext passwords: owner only
+        Vault::createPrivate(path);    // from the start, never an existing
+        ofstream out(path, ios::binary);    // file
+        if (!out)
+            throw runtime_error("Cannot open " + path);
+
+        auto const start = chrono::steady_clock::now();
+        size_t exported = 0;
+
+        out << "website,user,password\n";
+        vault.forEach([&](Credential const &credential)
+            {
+                writeField(out, credential.website);
+                out << ',';
+                writeField(out, credential.userIdentifier);
+                out << ',';
+                writeField(out, credential.password.data());
+                out << '\n';
+                ++exported;
+            }
+        );
+
+        if (!out.flush())
+            throw runtime_error("Writing " + path + " failed");
+
+        chrono::duration<double> const elapsed = 
+                                        chrono::steady_clock::now() - start;
+        cout << "✓ Exported " << exported << " credentials in " 
+             << elapsed.count() << " s.\n";
+    }
+    catch (exception const &ex)
+    {
+        cout << "Export failed: " << ex.what() << '\n';
+    }
+}
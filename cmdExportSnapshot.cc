@@ -0,0 +1,33 @@
+#include "main.ih"
+
+void cmdExportSnapshot(Vault &vault)
+{
+    string const path = IOTools::promptLine("Snapshot file: ");
+    if (path.empty())
+    {
+        cout << "Nothing exported (no file).\n";
+        return;
+    }
+    if (filesystem::exists(path))      // before asking for the password
+    {
+        cout << "Nothing exported: " << path << " already exists.\n";
+        return;
+    }
+
+    try
+    {
+        string master = IOTools::hiddenPrompt("Master password: ");
+
+        auto const start = chrono::steady_clock::now();
+        size_t const count = vault.exportSnapshot(path, master);
+        chrono::duration<double> const elapsed = 
+                                        chrono::steady_clock::now() - start;
+
+        cout << "✓ Wrote a snapshot of " << count << " entries to " << path
+             << " in " << elapsed.count() << " s.\n";
+    }
+    catch (exception const &ex)
+    {
+        cout << "Snapshot failed: " << ex.what() << '\n';
+    }
+}
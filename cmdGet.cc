@@ -13,11 +13,8 @@ void cmdGet(Vault &vault)
 
     try
     {
-        string password = vault.get(website, userId);
-        cout << "Password: " << password << '\n';
-                                       // Wipe after it has been displayed or 
-                                       // copied elsewhere
-        sodium_memzero(password.data(), password.size());
+        Secret const password = vault.get(website, userId);
+        cout << "Password: " << password.data() << '\n';
     }
     catch (exception const &ex)
     {
@@ -0,0 +1,63 @@
+#include "main.ih"
+
+namespace
+{                                      // streamed: one chunk in memory
+    size_t import(Vault &vault, istream &in, RecordReader::Format format,
+                  size_t chunkSize)
+    {
+        RecordReader reader(in, format);
+        return vault.addMany([&]
+                             {
+                                 return reader.next();
+                             }, chunkSize);
+    }
+}
+
+void cmdImport(Vault &vault)
+{
+    string const path = IOTools::promptLine("File (- for standard input): ");
+    string const format = IOTools::promptLine("Format [csv|nul] (csv): ");
+    string const chunk = IOTools::promptLine(
+                            "Rows per transaction (0 = all in one) (0): ");
+
+    if (path.empty() || (format != "" && format != "csv" && format != "nul"))
+    {
+        cout << "Nothing imported (no file or unknown format).\n";
+        return;
+    }
+
+    try
+    {
+        if (chunk.find_first_not_of("0123456789") != string::npos)
+            throw invalid_argument("“" + chunk + "” is not a row count");
+        size_t const chunkSize = chunk.empty() ? 0 : stoul(chunk);
+        RecordReader::Format const recordFormat = 
+            format == "nul" ? RecordReader::NUL : RecordReader::CSV;
+
+        auto const start = chrono::steady_clock::now();
+        size_t stored;
+        if (path == "-")
+        {
+            stored = import(vault, cin, recordFormat, chunkSize);
+            cin.clear();               // allow the command loop to go on 
+        }                              // after end of input (Ctrl-D)
+        else
+        {
+            ifstream in(path, ios::binary);
+            if (!in)
+                throw runtime_error("Cannot open " + path);
+            stored = import(vault, in, recordFormat, chunkSize);
+        }
+        chrono::duration<double> const elapsed = 
+                                        chrono::steady_clock::now() - start;
+
+        cout << "✓ Imported " << stored << " credentials in " 
+             << elapsed.count() << " s (" 
+             << (elapsed.count() > 0 ? stored / elapsed.count() : 0) 
+             << " rows/s).\n";
+    }
+    catch (exception const &ex)
+    {
+        cout << "Import failed: " << ex.what() << '\n';
+    }
+}
@@ -0,0 +1,16 @@
+#include "main.ih"
+
+void cmdList(Vault &vault)
+{
+    try
+    {
+        auto const names = vault.list();
+        for (auto const &[website, userIdentifier]: names)
+            cout << website << '\t' << userIdentifier << '\n';
+        cout << names.size() << " entries.\n";
+    }
+    catch (exception const &ex)
+    {
+        cout << ex.what() << '\n';
+    }
+}
@@ -0,0 +1,38 @@
+#include "main.ih"
+
+void cmdPasswd(Vault &vault)
+{
+    string current = IOTools::hiddenPrompt(
+                            "Current master password (or recovery key): ");
+    string next = IOTools::hiddenPrompt("New master password: ");
+    string confirm = IOTools::hiddenPrompt("Confirm new master password: ");
+
+    bool const same = next == confirm;
+    sodium_memzero(confirm.data(), confirm.size());
+    if (!same || next.empty())
+    {
+        sodium_memzero(current.data(), current.size());
+        sodium_memzero(next.data(), next.size());
+        cout << "Master password not changed: the new passwords are empty "
+                "or differ.\n";
+        return;
+    }
+
+    try
+    {
+        auto const start = chrono::steady_clock::now();
+        size_t const count = vault.changeMaster(current, next);
+        chrono::duration<double> const elapsed = 
+                                        chrono::steady_clock::now() - start;
+
+        cout << "✓ Master password changed in " << elapsed.count() << " s";
+        if (count != 0)                // once, for vaults without data key
+            cout << " (" << count << " entries re-encrypted under a new "
+                    "data key)";
+        cout << ".\n";
+    }
+    catch (exception const &ex)
+    {
+        cout << "Master password not changed: " << ex.what() << '\n';
+    }
+}
@@ -0,0 +1,19 @@
+#include "main.ih"
+
+void cmdRecovery(Vault &vault)
+{
+    try
+    {
+        string master = IOTools::hiddenPrompt("Master password: ");
+        Secret const key = vault.createRecoveryKey(master);
+
+        cout << "Recovery key (shown once; it unlocks the vault in place of "
+                "the master password, so store it offline):\n\n    " 
+             << key.data() << "\n\n"
+                "Any previous recovery key no longer works.\n";
+    }
+    catch (exception const &ex)
+    {
+        cout << "No recovery key created: " << ex.what() << '\n';
+    }
+}
@@ -0,0 +1,20 @@
+#include "main.ih"
+
+void cmdRekdf(Vault &vault)
+{
+    cout << "Current: " << vault.kdfParams() << '\n';
+
+    try
+    {
+        KdfParams const params = KdfParams::prompt();
+        string master = IOTools::hiddenPrompt("Master password: ");
+
+        size_t const count = vault.changeKdf(master, params);
+        cout << "✓ Re-encrypted " << count << " entries; now using: " 
+             << vault.kdfParams() << '\n';
+    }
+    catch (exception const &ex)
+    {
+        cout << "KDF parameters not changed: " << ex.what() << '\n';
+    }
+}
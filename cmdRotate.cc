@@ -0,0 +1,27 @@
+#include "main.ih"
+
+void cmdRotate(Vault &vault)
+{
+    try
+    {
+        string master = IOTools::hiddenPrompt("Master password: ");
+
+        auto const start = chrono::steady_clock::now();
+        size_t const count = vault.rotateKey(master, 1024, 0,
+            [](size_t done, size_t total)
+            {
+                cout << "\rRe-encrypted " << done << " / " << total 
+                     << flush;
+            });
+        chrono::duration<double> const elapsed = 
+                                        chrono::steady_clock::now() - start;
+
+        cout << (count != 0 ? "\n" : "") << "✓ Rotated the key; " << count 
+             << " entries re-encrypted in " << elapsed.count() << " s.\n"
+                "Any recovery key was revoked.\n";
+    }
+    catch (exception const &ex)
+    {
+        cout << "\nKey not rotated: " << ex.what() << '\n';
+    }
+}
@@ -0,0 +1,29 @@
+#include "main.ih"
+
+void cmdSearch(Vault &vault, string fragment)
+{
+    if (fragment.empty())              // not given after the command
+        fragment = IOTools::promptLine("Search for: ");
+    if (fragment.empty())
+    {
+        cout << "Search aborted (empty fragment).\n";
+        return;
+    }
+
+    try
+    {
+        auto const start = chrono::steady_clock::now();
+        auto const matches = vault.search(fragment);
+        chrono::duration<double, milli> const ms = 
+                                    chrono::steady_clock::now() - start;
+
+        for (TrigramIndex::Match const &match: matches)
+            cout << (match.score < 1 ? "~ " : "  ")   // ~: fuzzy match
+                 << match.website << '\t' << match.userIdentifier << '\n';
+        cout << matches.size() << " matches (" << ms.count() << " ms).\n";
+    }
+    catch (exception const &ex)
+    {
+        cout << ex.what() << '\n';
+    }
+}
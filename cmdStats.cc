@@ -0,0 +1,7 @@
+#include "main.ih"
+
+void cmdStats(Vault &)
+{
+    cout << StageStats::instance() 
+         << "(percentiles: upper bound of a power-of-2 bucket)\n";
+}
@@ -0,0 +1,31 @@
+#include "connectionPool.ih"
+
+ConnectionPool::Lease ConnectionPool::acquire()
+{
+    unique_lock lock(d_mutex);
+    d_returned.wait(lock, [&]
+                    {
+                        return !d_idle.empty() || d_open < d_capacity;
+                    });
+
+    if (!d_idle.empty())               // most recently used first: its 
+    {                                  // statements and pages are warm
+        DbHandle db = move(d_idle.back());
+        d_idle.pop_back();
+        return Lease(*this, move(db));
+    }
+
+    ++d_open;                          // reserve the slot, open unlocked
+    lock.unlock();
+    try
+    {
+        return Lease(*this, connect());
+    }
+    catch (...)
+    {
+        lock.lock();
+        --d_open;
+        d_returned.notify_one();
+        throw;
+    }
+}
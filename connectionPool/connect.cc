@@ -0,0 +1,10 @@
+#include "connectionPool.ih"
+
+DbHandle ConnectionPool::connect() const
+{
+    DbHandle db(d_filename, SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX);
+                                       // a reader only waits while another
+    sqlite3_busy_timeout(db, 5000);    // connection recovers the WAL index
+    db.exec(d_pragmas);
+    return db;
+}
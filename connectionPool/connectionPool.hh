@@ -0,0 +1,82 @@
+#ifndef INCLUDED_CONNECTIONPOOL_
+#define INCLUDED_CONNECTIONPOOL_
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "../dbHandle/dbHandle.hh"
+#include "../durability/durability.hh"
+
+/**
+ * \brief Bounded pool of read-only connections to one database file.
+ *
+ * `acquire()` hands out an idle connection, opens a new one while fewer than
+ * `capacity` are open, or waits until another thread returns one. A `Lease`
+ * gives its thread exclusive use of the connection (and of its prepared
+ * statement cache) and returns it to the pool when it goes out of scope.
+ * Connections are opened `SQLITE_OPEN_READONLY`; in WAL mode they read
+ * concurrently with each other and with a writer on another connection.
+ * All members are thread-safe.
+ */
+class ConnectionPool
+{
+    std::string d_filename;
+    std::string d_pragmas;             // per-connection read settings
+    size_t d_capacity;                 // most connections open at once
+
+    mutable std::mutex d_mutex;
+    std::condition_variable d_returned;
+    std::vector<DbHandle> d_idle;
+    size_t d_open = 0;                 // idle and leased
+
+    public:
+        class Lease;
+
+        /** Pool for `filename`, applying the cache and mmap sizes of 
+         *  `settings` to each connection; `capacity` 0 selects the 
+         *  hardware concurrency.*/
+        ConnectionPool(std::string filename, Durability const &settings,
+                       size_t capacity = 0);
+
+        ConnectionPool(ConnectionPool const &other) = delete;
+        ConnectionPool &operator=(ConnectionPool const &other) = delete;
+
+        /** Borrow a connection, waiting while all `capacity` are leased.
+         *  \throws std::runtime_error if a new connection cannot be opened.*/
+        Lease acquire();
+
+        /** Number of connections currently open. */
+        size_t open() const;
+
+    private:
+        /** Open a read-only connection with the pool's settings. */
+        DbHandle connect() const;
+
+        /** Take back a leased connection. */
+        void release(DbHandle &&db) noexcept;
+};
+
+/**
+ * \brief Exclusive use of one pooled connection until destruction.
+ */
+class ConnectionPool::Lease
+{
+    ConnectionPool &d_pool;
+    DbHandle d_db;
+
+    public:
+        Lease(ConnectionPool &pool, DbHandle &&db);
+
+        Lease(Lease const &other) = delete;
+        Lease &operator=(Lease const &other) = delete;
+
+        ~Lease();
+
+        /** The borrowed connection. */
+        DbHandle const &db() const;
+};
+
+#endif
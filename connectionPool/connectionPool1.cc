@@ -0,0 +1,13 @@
+#include "connectionPool.ih"
+
+ConnectionPool::ConnectionPool(string filename, Durability const &settings,
+                               size_t capacity)
+:
+    d_filename(move(filename)),
+    d_pragmas("PRAGMA mmap_size="  + to_string(settings.mmapSize) + ";"
+              "PRAGMA cache_size=" + to_string(settings.cacheSize) + ";"),
+    d_capacity(capacity != 0 ? capacity 
+                             : max(thread::hardware_concurrency(), 1u))
+{                                      // release() then never allocates
+    d_idle.reserve(d_capacity);
+}
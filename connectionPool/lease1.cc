@@ -0,0 +1,7 @@
+#include "connectionPool.ih"
+
+ConnectionPool::Lease::Lease(ConnectionPool &pool, DbHandle &&db)
+:
+    d_pool(pool),
+    d_db(move(db))
+{}
@@ -0,0 +1,6 @@
+#include "connectionPool.ih"
+
+DbHandle const &ConnectionPool::Lease::db() const
+{
+    return d_db;
+}
@@ -0,0 +1,6 @@
+#include "connectionPool.ih"
+
+ConnectionPool::Lease::~Lease()
+{
+    d_pool.release(move(d_db));
+}
@@ -0,0 +1,7 @@
+#include "connectionPool.ih"
+
+size_t ConnectionPool::open() const
+{
+    lock_guard lock(d_mutex);
+    return d_open;
+}
@@ -0,0 +1,10 @@
+#include "connectionPool.ih"
+
+void ConnectionPool::release(DbHandle &&db) noexcept
+{
+    {
+        lock_guard lock(d_mutex);
+        d_idle.push_back(move(db));
+    }
+    d_returned.notify_one();
+}
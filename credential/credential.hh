@@ -0,0 +1,21 @@
+#ifndef INCLUDED_CREDENTIAL_
+#define INCLUDED_CREDENTIAL_
+
+#include <string>
+
+#include "../secret/secret.hh"
+
+/**
+ * \brief One plaintext vault entry: (website, userIdentifier) and its 
+ *        password.
+ *
+ * Move-only because the password is held in a `Secret`.
+ */
+struct Credential
+{
+    std::string website;
+    std::string userIdentifier;
+    Secret      password;
+};
+
+#endif
@@ -0,0 +1,14 @@
+#include "dbHandle.ih"
+
+void DbHandle::close() noexcept
+{
+    for (auto &entry: d_cache)         // sqlite3_close refuses to close a
+        sqlite3_finalize(entry.second);// connection with live statements
+    d_cache.clear();
+
+    if (d_db)
+    {
+        sqlite3_close(d_db);
+        d_db = nullptr;
+    }
+}
@@ -1,8 +1,13 @@
 #ifndef INCLUDED_DBHANDLE_
 #define INCLUDED_DBHANDLE_
 
+#include <functional>
+#include <map>
 #include <sqlite3.h>
 #include <string>
+#include <string_view>
+
+#include "../statement/statement.hh"
 
 /**
  * \brief RAII wrapper around a `sqlite3*` connection.
@@ -11,13 +16,24 @@
  * connection in the destructor. Copy is disabled; move transfers ownership of
  * the raw handle. Implicit conversion to `sqlite3*` is provided for use with
  * the SQLite C API.
+ *
+ * The handle also owns a per-connection cache of prepared statements, keyed
+ * by their SQL text: each query is compiled once and handed out again (reset,
+ * bindings cleared) on every later `prepare`. Cached statements are finalized
+ * before the connection is closed.
  */
 class DbHandle                         
 {
     sqlite3 *d_db = nullptr;
+                                       // SQL text -> compiled statement
+    mutable std::map<std::string, sqlite3_stmt *, std::less<>> d_cache;
 
     public:
-        DbHandle(std::string const &filename = "vault.db");
+        /** Open `filename` with `sqlite3_open_v2` `flags`; by default
+         *  read-write, created if missing, without SQLite's own mutex.*/
+        DbHandle(std::string const &filename = "vault.db",
+                 int flags = SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE 
+                             | SQLITE_OPEN_NOMUTEX);
 
         DbHandle(DbHandle const &other) = delete;
         DbHandle(DbHandle &&tmp) noexcept;
@@ -28,6 +44,23 @@ class DbHandle
         ~DbHandle();
 
         operator sqlite3*() const noexcept;
+
+        /**
+         * Return the cached statement for `sql`, preparing it on first use.
+         * The returned `Statement` borrows the cache entry and rewinds it when
+         * it goes out of scope, so at most one `Statement` per SQL text should
+         * be alive at a time.
+         * \throws std::runtime_error if SQLite cannot compile `sql`.
+         */
+        Statement prepare(std::string_view sql) const;
+
+        /** Execute one or more SQL statements that return no data.
+         *  \throws std::runtime_error with SQLite's message on failure.*/
+        void exec(std::string const &sql) const;
+
+    private:
+        /** Finalize all cached statements, then close the connection. */
+        void close() noexcept;
 };
 
-#endif
\ No newline at end of file
+#endif
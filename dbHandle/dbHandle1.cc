@@ -1,8 +1,7 @@
 #include "dbHandle.ih"
 
-DbHandle::DbHandle(string const &filename)
+DbHandle::DbHandle(string const &filename, int flags)
 {   
-    size_t flags = SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_NOMUTEX;
     if (sqlite3_open_v2(filename.c_str(), &d_db, flags, nullptr) != SQLITE_OK)
     {
         string const errorMessage = d_db ? 
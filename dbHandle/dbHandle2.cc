@@ -2,5 +2,6 @@
 
 DbHandle::DbHandle(DbHandle &&tmp) noexcept
 :
-    d_db(exchange(tmp.d_db, nullptr))
-{}
\ No newline at end of file
+    d_db(exchange(tmp.d_db, nullptr)),
+    d_cache(move(tmp.d_cache))
+{}
@@ -2,6 +2,5 @@
 
 DbHandle::~DbHandle()
 {
-    if (d_db)
-        sqlite3_close(d_db);
-}
\ No newline at end of file
+    close();
+}
@@ -0,0 +1,12 @@
+#include "dbHandle.ih"
+
+void DbHandle::exec(string const &sql) const
+{
+    char *errmsg = nullptr;
+    if (sqlite3_exec(d_db, sql.c_str(), nullptr, nullptr, &errmsg) != SQLITE_OK)
+    {
+        string const errorMessage = errmsg ? errmsg : sqlite3_errmsg(d_db);
+        sqlite3_free(errmsg);          // allocated by SQLite
+        throw runtime_error("SQLite error: " + errorMessage);
+    }
+}
@@ -4,10 +4,11 @@ DbHandle &DbHandle::operator=(DbHandle &&tmp) noexcept
 {
     if (this != &tmp)
     {
-        if (d_db)
-            sqlite3_close(d_db);
+        close();
         d_db = exchange(tmp.d_db, nullptr);
+        d_cache = move(tmp.d_cache);
+        tmp.d_cache.clear();
     }
     
     return *this;
-}
\ No newline at end of file
+}
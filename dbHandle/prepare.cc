@@ -0,0 +1,19 @@
+#include "dbHandle.ih"
+
+Statement DbHandle::prepare(string_view sql) const
+{
+    auto iter = d_cache.find(sql);
+    if (iter == d_cache.end())         // first use: compile and keep it
+    {
+        sqlite3_stmt *statement = nullptr;
+        if (sqlite3_prepare_v3(d_db, sql.data(), static_cast<int>(sql.size()),
+                               SQLITE_PREPARE_PERSISTENT, 
+                               &statement, nullptr) != SQLITE_OK)
+            throw runtime_error("SQLite prepare failed: " 
+                                + string(sqlite3_errmsg(d_db)));
+
+        iter = d_cache.emplace(sql, statement).first;
+    }
+
+    return Statement{ iter->second };
+}
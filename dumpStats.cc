@@ -0,0 +1,16 @@
+#include "main.ih"
+
+void dumpStats()
+{
+    char const *path = getenv("CERBERUS_STATS_JSON");
+    if (path == nullptr || *path == 0)
+        return;
+
+    ofstream out(path);
+    if (!out)
+    {
+        cerr << "Cannot write the statistics to " << path << '\n';
+        return;
+    }
+    StageStats::instance().writeJson(out);
+}
@@ -0,0 +1,20 @@
+#include "durability.ih"
+
+void Durability::apply(sqlite3 *db) const
+{
+    string const pragmas = 
+        "PRAGMA journal_mode=" + journalMode + ";"
+        "PRAGMA synchronous="  + synchronous + ";"
+        "PRAGMA mmap_size="    + to_string(mmapSize) + ";"
+        "PRAGMA cache_size="   + to_string(cacheSize) + ";";
+
+    char *errmsg = nullptr;
+    if (sqlite3_exec(db, pragmas.c_str(), nullptr, nullptr, &errmsg) 
+            != SQLITE_OK)
+    {
+        string const errorMessage = errmsg ? errmsg : sqlite3_errmsg(db);
+        sqlite3_free(errmsg);
+        throw runtime_error("Applying the durability profile failed: " 
+                            + errorMessage);
+    }
+}
@@ -0,0 +1,53 @@
+#ifndef INCLUDED_DURABILITY_
+#define INCLUDED_DURABILITY_
+
+#include <array>
+#include <iosfwd>
+#include <sqlite3.h>
+#include <string>
+
+/**
+ * \brief SQLite durability / journal settings of a vault file.
+ *
+ * Trades crash safety against write throughput. The default-constructed
+ * profile equals SQLite's own defaults (rollback journal, synchronous=FULL,
+ * no mmap, ~2 MiB page cache, 4 KiB pages). The profile is stored in the
+ * vault's `meta` table and applied every time the vault is opened.
+ */
+struct Durability
+{
+    std::string journalMode = "DELETE";// DELETE | TRUNCATE | PERSIST | WAL
+    std::string synchronous = "FULL";  // OFF | NORMAL | FULL | EXTRA
+    long long   mmapSize    = 0;       // bytes of the file to memory-map
+    long long   cacheSize   = -2000;   // pages, or KiB when negative
+    long long   pageSize    = 4096;    // bytes; a power of 2 in [512, 65536]
+
+    /**
+     * Named profiles: "safe" (the defaults), "balanced" (WAL with
+     * synchronous=NORMAL: no corruption on power loss, but the last commits
+     * may roll back) and "fast" (WAL without syncing at all).
+     * \throws std::invalid_argument for an unknown name.
+     */
+    static Durability preset(std::string const &name);
+
+    /** The names `preset` knows, safest first.*/
+    static constexpr std::array<char const *, 3> PRESETS{ "safe", 
+                                                          "balanced", 
+                                                          "fast" };
+
+    /** \throws std::invalid_argument if a field holds an unsupported value.*/
+    void validate() const;
+
+    /**
+     * Issue the journal_mode, synchronous, mmap_size and cache_size PRAGMAs
+     * on `db`. The page size of an existing database only changes when it is
+     * rebuilt, see `Vault::setDurability`.
+     * \throws std::runtime_error if SQLite rejects a PRAGMA.
+     */
+    void apply(sqlite3 *db) const;
+};
+
+/** Print the profile as `journal_mode=... synchronous=... ...`. */
+std::ostream &operator<<(std::ostream &out, Durability const &profile);
+
+#endif
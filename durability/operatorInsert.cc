@@ -0,0 +1,10 @@
+#include "durability.ih"
+
+ostream &operator<<(ostream &out, Durability const &profile)
+{
+    return out << "journal_mode=" << profile.journalMode
+               << " synchronous=" << profile.synchronous
+               << " mmap_size="   << profile.mmapSize
+               << " cache_size="  << profile.cacheSize
+               << " page_size="   << profile.pageSize;
+}
@@ -0,0 +1,16 @@
+#include "durability.ih"
+                                       // static
+Durability Durability::preset(string const &name)
+{
+    if (name == "safe")
+        return Durability{};
+
+    if (name == "balanced")
+        return Durability{ "WAL", "NORMAL", 64 << 20, -16384, 4096 };
+
+    if (name == "fast")
+        return Durability{ "WAL", "OFF", 256 << 20, -65536, 4096 };
+
+    throw invalid_argument("Unknown durability profile “" + name 
+                           + "” (safe, balanced or fast).");
+}
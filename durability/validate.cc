@@ -0,0 +1,24 @@
+#include "durability.ih"
+
+void Durability::validate() const
+{
+    if (journalMode != "DELETE" && journalMode != "TRUNCATE" 
+        && journalMode != "PERSIST" && journalMode != "WAL")
+        throw invalid_argument("journal_mode must be DELETE, TRUNCATE, "
+                               "PERSIST or WAL");
+
+    if (synchronous != "OFF" && synchronous != "NORMAL" 
+        && synchronous != "FULL" && synchronous != "EXTRA")
+        throw invalid_argument("synchronous must be OFF, NORMAL, FULL or "
+                               "EXTRA");
+
+    if (mmapSize < 0)
+        throw invalid_argument("mmap_size must not be negative");
+
+    if (cacheSize == 0)
+        throw invalid_argument("cache_size must not be 0");
+                                       // a power of 2 in [512, 65536]
+    if (pageSize < 512 || pageSize > 65536 || (pageSize & (pageSize - 1)))
+        throw invalid_argument("page_size must be a power of 2 between 512 "
+                               "and 65536");
+}
@@ -0,0 +1,33 @@
+#include "kdfParams.ih"
+
+namespace
+{
+    chrono::duration<double> timeRun(KdfParams const &params)
+    {
+        unsigned char key[crypto_pwhash_BYTES_MIN];
+        uint8_t salt[crypto_pwhash_SALTBYTES] = {};
+
+        auto const start = chrono::steady_clock::now();
+        params.derive(key, "calibration", salt);
+        return chrono::steady_clock::now() - start;
+    }
+}
+                                       // static
+KdfParams KdfParams::calibrate(chrono::milliseconds target, size_t memCeiling)
+{
+    KdfParams params{ crypto_pwhash_OPSLIMIT_MIN, 
+                      clamp<size_t>(memCeiling, crypto_pwhash_MEMLIMIT_MIN,
+                                    size_t{ MAX_MEM_MIB } << 20) };
+                                       // memory first: halve it until a 
+    chrono::duration<double> pass = timeRun(params);   // single pass fits
+    while (pass > target && params.memLimit / 2 >= crypto_pwhash_MEMLIMIT_MIN)
+    {
+        params.memLimit /= 2;
+        pass = timeRun(params);
+    }
+                                       // then passes: time grows linearly
+    params.opsLimit = clamp<unsigned long long>(
+                                static_cast<unsigned long long>(target / pass),
+                                crypto_pwhash_OPSLIMIT_MIN, MAX_OPS_LIMIT);
+    return params;
+}
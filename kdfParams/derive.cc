@@ -0,0 +1,15 @@
+#include "kdfParams.ih"
+
+void KdfParams::derive(span<unsigned char> out, string const &master,
+                       span<uint8_t const> salt) const
+{
+    if (salt.size() != crypto_pwhash_SALTBYTES)
+        throw runtime_error("Invalid salt size");
+
+    if (crypto_pwhash(out.data(), out.size(),
+                      master.data(), master.size(),
+                      salt.data(),
+                      opsLimit, memLimit,
+                      crypto_pwhash_ALG_DEFAULT) != 0)
+        throw runtime_error("Key derivation failed");
+}
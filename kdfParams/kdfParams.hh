@@ -0,0 +1,66 @@
+#ifndef INCLUDED_KDFPARAMS_
+#define INCLUDED_KDFPARAMS_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <sodium.h>
+#include <span>
+#include <string>
+
+/**
+ * \brief Argon2id cost parameters of a vault.
+ *
+ * Stored next to the salt in the vault's `meta` table, so every vault can
+ * have its own cost: light for CI containers, heavy for high-security vaults.
+ * Vaults without stored parameters use libsodium's MODERATE limits, which
+ * are also the defaults here.
+ *
+ * Costs are also read from files that may be forged (backup archives,
+ * snapshots), before any password is checked, so `validate` caps them well
+ * below libsodium's own limits: at MAX_OPS_LIMIT passes and MAX_MEM_MIB of
+ * memory, which `calibrate` never exceeds either.
+ */
+struct KdfParams
+{
+    enum : size_t
+    {
+        MAX_OPS_LIMIT = 1024,          // passes
+        MAX_MEM_MIB   = 4096           // 4 GiB
+    };
+
+    unsigned long long opsLimit = crypto_pwhash_OPSLIMIT_MODERATE;
+    size_t             memLimit = crypto_pwhash_MEMLIMIT_MODERATE;   // bytes
+
+    /**
+     * Benchmark Argon2id on this host and pick parameters for an unlock 
+     * taking about `target`: the largest memory limit up to `memCeiling` for
+     * which one pass fits in `target`, then as many passes as fit, within
+     * MAX_MEM_MIB and MAX_OPS_LIMIT.
+     */
+    static KdfParams calibrate(std::chrono::milliseconds target, 
+                               size_t memCeiling);
+
+    /**
+     * Ask for a target unlock time and memory ceiling and calibrate; an
+     * empty answer to the first question keeps the defaults.
+     */
+    static KdfParams prompt();
+
+    /** \throws std::invalid_argument if libsodium would reject the limits
+     *          or they exceed MAX_OPS_LIMIT or MAX_MEM_MIB.*/
+    void validate() const;
+
+    /**
+     * Derive `out.size()` bytes from `master` and `salt` with Argon2id.
+     * \throws std::runtime_error if derivation fails (e.g. out of memory).
+     */
+    void derive(std::span<unsigned char> out, std::string const &master,
+                std::span<std::uint8_t const> salt) const;
+};
+
+/** Print as `opslimit=... memlimit=... KiB`. */
+std::ostream &operator<<(std::ostream &out, KdfParams const &params);
+
+#endif
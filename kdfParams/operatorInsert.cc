@@ -0,0 +1,7 @@
+#include "kdfParams.ih"
+
+ostream &operator<<(ostream &out, KdfParams const &params)
+{
+    return out << "opslimit=" << params.opsLimit 
+               << " memlimit=" << (params.memLimit >> 10) << " KiB";
+}
@@ -0,0 +1,31 @@
+#include "kdfParams.ih"
+
+namespace
+{
+    enum
+    {
+        DEFAULT_CEILING_MIB = crypto_pwhash_MEMLIMIT_MODERATE >> 20
+    };
+}
+                                       // static
+KdfParams KdfParams::prompt()
+{
+    string const target = IOTools::promptLine(
+                "Target unlock time in ms (empty: libsodium MODERATE): ");
+    if (target.empty())
+        return KdfParams{};
+
+    string const ceiling = IOTools::promptLine(
+                "Memory ceiling in MiB (" + to_string(DEFAULT_CEILING_MIB) 
+                + "): ");
+
+    size_t const mebibytes = ceiling.empty() 
+                                ? static_cast<size_t>(DEFAULT_CEILING_MIB)
+                                : stoul(ceiling);
+
+    cout << "Calibrating Argon2id..." << flush;
+    KdfParams const params = calibrate(chrono::milliseconds(stoul(target)),
+                                       mebibytes << 20);
+    cout << ' ' << params << '\n';
+    return params;
+}
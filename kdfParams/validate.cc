@@ -0,0 +1,25 @@
+#include "kdfParams.ih"
+
+void KdfParams::validate() const
+{
+    if (opsLimit < crypto_pwhash_OPSLIMIT_MIN)
+        throw invalid_argument("Argon2 opslimit must be at least " 
+                               + to_string(crypto_pwhash_OPSLIMIT_MIN));
+
+    unsigned long long const maxOps = min<unsigned long long>(
+                                MAX_OPS_LIMIT, crypto_pwhash_OPSLIMIT_MAX);
+    if (opsLimit > maxOps)
+        throw invalid_argument("Argon2 opslimit must be at most " 
+                               + to_string(maxOps));
+
+    if (memLimit < crypto_pwhash_MEMLIMIT_MIN)
+        throw invalid_argument("Argon2 memlimit must be at least " 
+                               + to_string(crypto_pwhash_MEMLIMIT_MIN) 
+                               + " bytes");
+
+    size_t const maxMem = min<size_t>(size_t{ MAX_MEM_MIB } << 20, 
+                                      crypto_pwhash_MEMLIMIT_MAX);
+    if (memLimit > maxMem)
+        throw invalid_argument("Argon2 memlimit must be at most " 
+                               + to_string(maxMem) + " bytes");
+}
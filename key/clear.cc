@@ -2,6 +2,6 @@
 
 void Key::clear()
 {
-    sodium_memzero(d_data.data(), d_data.size());
+    sodium_memzero(d_data, SIZE);
     d_valid = false;
 }
\ No newline at end of file
@@ -2,5 +2,5 @@
 
 unsigned char *Key::data()
 {
-    return d_data.data();
+    return d_data;
 }
\ No newline at end of file
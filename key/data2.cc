@@ -2,5 +2,5 @@
 
 unsigned char const *Key::data() const
 {
-    return d_data.data();
+    return d_data;
 }
\ No newline at end of file
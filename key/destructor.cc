@@ -3,4 +3,5 @@
 Key::~Key()
 {
     clear();
-}
\ No newline at end of file
+    SecureArena::instance().deallocate(d_data, SIZE);
+}
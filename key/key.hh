@@ -1,24 +1,31 @@
 #ifndef INCLUDED_KEY_
 #define INCLUDED_KEY_
 
-#include <array>
+#include <cstddef>
 #include <sodium.h>
 
-
 /**
  * \brief Owner of a 32-byte AEAD session key with secure zeroization.
  *
  * Provides move-only semantics, explicit validity tracking, and accessors to
  * the raw key bytes for use with libsodium. All destructive operations call
  * `sodium_memzero` to reduce the risk of key material lingering in memory.
+ * The key bytes live in the `SecureArena`: locked into RAM, so they are 
+ * never written to swap, in chunks framed by guard pages (shared with 
+ * other secrets, not one pair per key).
  */
 class Key
 {
-    std::array<uint8_t, crypto_aead_xchacha20poly1305_ietf_KEYBYTES> d_data{};
+    enum
+    {
+        SIZE = crypto_aead_xchacha20poly1305_ietf_KEYBYTES
+    };
+
+    unsigned char *d_data;             // SIZE bytes in the secure arena
     bool d_valid = false;
 
     public:
-        Key() = default;
+        Key();
 
         Key(Key const &other) = delete;
         Key(Key &&tmp);
@@ -2,8 +2,9 @@
 
 Key::Key(Key &&tmp)
 :
-    d_data(tmp.d_data),
-    d_valid(tmp.d_valid)
-{
+    Key()
+{                                      // each key keeps its own block
+    memcpy(d_data, tmp.d_data, SIZE);
+    d_valid = tmp.d_valid;
     tmp.clear();
-}
\ No newline at end of file
+}
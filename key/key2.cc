@@ -0,0 +1,8 @@
+#include "key.ih"
+
+Key::Key()
+:                                      // zero-filled, locked and guarded
+    d_data(static_cast<unsigned char *>(SecureArena::instance().allocate(SIZE)))
+{
+    memset(d_data, 0, SIZE);
+}
@@ -6,7 +6,7 @@ Key &Key::operator=(Key &&tmp)
     {
         clear();
 
-        d_data = tmp.d_data;
+        memcpy(d_data, tmp.d_data, SIZE);
         d_valid = tmp.d_valid;
 
         tmp.clear();
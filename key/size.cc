@@ -2,5 +2,5 @@
 
 size_t Key::size() const
 {
-    return d_data.size();
+    return SIZE;
 }
\ No newline at end of file
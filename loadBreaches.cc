@@ -0,0 +1,29 @@
+#include "main.ih"
+                                       // opened by the first add or audit
+void loadBreaches(Vault &vault)
+{
+    char const *path = getenv("CERBERUS_BREACH_CORPUS");
+    if (path == nullptr || *path == 0)
+        return;
+
+    vault.setBreachIndex([filename = string(path)]
+    {
+        shared_ptr<BreachIndex const> breaches;
+        try
+        {
+            auto const start = chrono::steady_clock::now();
+            breaches = make_shared<BreachIndex const>(filename);
+            chrono::duration<double> const seconds = 
+                                    chrono::steady_clock::now() - start;
+
+            cout << "Breach corpus: " << breaches->size() 
+                 << " hashes (loaded in " << seconds.count() << " s).\n";
+        }
+        catch (exception const &ex)    // a bad corpus: carry on without
+        {
+            cerr << "Breach corpus “" << filename << "” not used: " 
+                 << ex.what() << '\n';
+        }
+        return breaches;
+    });
+}
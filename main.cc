@@ -1,28 +1,77 @@
 #include "main.ih"
 
-int main()
+int main(int argc, char *argv[])
 try
-{
+{                                      // must precede multi-threaded use
+    if (sodium_init() < 0)             // of libsodium
+        throw runtime_error("libsodium could not be initialized");
+
+    if (argc > 1)                      // one-shot agent / client modes
+    {
+        string const mode = argv[1];
+        return mode == "agent"         ? runAgent(argc, argv) 
+             : mode == "find"          ? runFind(argc, argv)
+             : mode == "search"        ? runSearch(argc, argv)
+             : mode == "restore"       ? runRestore(argc, argv)
+             : mode == "snapshot"      ? runSnapshot(argc, argv)
+             : mode == "breach-corpus" ? runBreachCorpus(argc, argv)
+             :                           runClient(argc, argv);
+    }
+
+    StatsGuard const statsGuard;       // also if the session fails
     Vault vault;                       
 
     if (vault.isInitialized())
         vault.unlock();
     else
         vault.setup();
+    loadBreaches(vault);
 
     for (;;)
     {
-        cout << "\nCommands:  add   get   quit\n> ";
+        cout << "\nCommands:  add   get   list   search   audit   import   export   export-snapshot   durability   backup   passwd   recovery   rekdf   rotate   blind   compact   stats   quit\n> ";
         string cmd;
         if (!(cin >> cmd))
             break;                     // EOF / Ctrl-D
-                                       // consume newline left by >> 
-        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                                       // rest of the line: `search` takes
+        string args;                   // its fragment from it
+        getline(cin, args);
+        args.erase(0, args.find_first_not_of(" \t"));
 
         if (cmd == "add")
             cmdAdd(vault);
         else if (cmd == "get")
             cmdGet(vault);
+        else if (cmd == "list")
+            cmdList(vault);
+        else if (cmd == "search")
+            cmdSearch(vault, args);
+        else if (cmd == "audit")
+            cmdAudit(vault);
+        else if (cmd == "import")
+            cmdImport(vault);
+        else if (cmd == "export")
+            cmdExport(vault);
+        else if (cmd == "export-snapshot")
+            cmdExportSnapshot(vault);
+        else if (cmd == "durability")
+            cmdDurability(vault);
+        else if (cmd == "backup")
+            cmdBackup(vault);
+        else if (cmd == "passwd")
+            cmdPasswd(vault);
+        else if (cmd == "recovery")
+            cmdRecovery(vault);
+        else if (cmd == "rekdf")
+            cmdRekdf(vault);
+        else if (cmd == "rotate")
+            cmdRotate(vault);
+        else if (cmd == "blind")
+            cmdBlind(vault);
+        else if (cmd == "compact")
+            cmdCompact(vault);
+        else if (cmd == "stats")
+            cmdStats(vault);
         else if (cmd == "quit" || cmd == "exit")
             break;
         else
@@ -0,0 +1,19 @@
+#include "multiVault.ih"
+
+vector<MultiVault::Match> MultiVault::get(string const &website,
+                                          string const &userIdentifier) const
+{
+    vector<optional<Secret>> found(d_mounts.size());
+
+    d_pool.run(d_mounts.size(), [&](size_t idx)
+    {
+        if (d_mounts[idx].unlocked)
+            found[idx] = d_mounts[idx].vault->find(website, userIdentifier);
+    });
+
+    vector<Match> matches;             // merged in mount order
+    for (size_t idx = 0; idx != d_mounts.size(); ++idx)
+        if (found[idx])
+            matches.push_back({ d_mounts[idx].name, move(*found[idx]) });
+    return matches;
+}
@@ -0,0 +1,108 @@
+#ifndef INCLUDED_MULTIVAULT_
+#define INCLUDED_MULTIVAULT_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../secret/secret.hh"
+#include "../vault/vault.hh"
+#include "../workerPool/workerPool.hh"
+
+/**
+ * \brief Several vault files, mounted side by side and searched at once.
+ *
+ * Every vault keeps its own connection, salt, Argon2 cost and data key:
+ * a `MultiVault` only fans work out over them. Unlocking runs the vaults'
+ * key derivations in parallel, and `get` and `search` probe all unlocked
+ * vaults in parallel, so a lookup takes about as long as the slowest single
+ * vault instead of the sum. Results carry the name of the vault they came from
+ * (the file name without directory and extension, or the full file name if
+ * two vaults would share it).
+ *
+ * A MultiVault is used from one thread; each vault is only ever used by one
+ * pool thread at a time.
+ */
+class MultiVault
+{
+    struct Mount
+    {
+        std::string name;              // tag of its results
+        std::unique_ptr<Vault> vault;
+        bool unlocked = false;
+    };
+
+    std::vector<Mount> d_mounts;
+    mutable WorkerPool d_pool;         // one task per vault
+
+    public:
+        /** A password found in one of the vaults. */
+        struct Match
+        {
+            std::string vault;         // name of the vault holding it
+            Secret password;
+        };
+
+        /** An entry of one of the vaults matching a search. */
+        struct Hit
+        {
+            std::string vault;         // name of the vault holding it
+            TrigramIndex::Match match;
+        };
+
+        /**
+         * Open the existing, initialized vault files `filenames` on a pool
+         * of `threads` threads (0: one per vault).
+         * \throws std::invalid_argument if `filenames` is empty,
+         *         std::runtime_error if a file is missing, not a vault, or
+         *         on DB error.
+         */
+        explicit MultiVault(std::vector<std::string> const &filenames,
+                            size_t threads = 0);
+
+        MultiVault(MultiVault const &other) = delete;
+        MultiVault &operator=(MultiVault const &other) = delete;
+
+        /** Number of mounted vaults. */
+        size_t size() const;
+
+        /** Name of vault `idx`, as used in `Match::vault`. */
+        std::string const &name(size_t idx) const;
+
+        /** True if vault `idx` has been unlocked. */
+        bool unlocked(size_t idx) const;
+
+        /**
+         * Try `master` on every vault that is still locked, all in 
+         * parallel (each with its own salt and Argon2 cost, so memory use
+         * adds up). `master` is wiped.
+         * \returns the number of vaults it unlocked.
+         */
+        size_t unlock(std::string &master);
+
+        /** Unlock vault `idx` with `master`, which is wiped; false if it 
+         *  is the wrong password. */
+        bool unlock(size_t idx, std::string &master);
+
+        /**
+         * Look (website, userIdentifier) up in every unlocked vault in 
+         * parallel; the matches are returned in mount order.
+         * \throws std::runtime_error if an entry fails to authenticate or
+         *         on DB error.
+         */
+        std::vector<Match> get(std::string const &website,
+                               std::string const &userIdentifier) const;
+
+        /**
+         * `Vault::search` for `fragment` in every unlocked vault in 
+         * parallel, merged: the at most `limit` (0: all) best matches of
+         * all vaults, best first, equal scores in mount order.
+         * \throws std::runtime_error on DB error.
+         */
+        std::vector<Hit> search(std::string_view fragment, 
+                                size_t limit = 20) const;
+};
+
+#endif
@@ -0,0 +1,35 @@
+#include "multiVault.ih"
+
+MultiVault::MultiVault(vector<string> const &filenames, size_t threads)
+:
+    d_mounts(filenames.size()),
+    d_pool(threads != 0 ? threads : filenames.size())
+{
+    if (filenames.empty())
+        throw invalid_argument("No vault files given");
+
+    set<string> stems;
+    set<string> clashes;               // stems shared by several files
+    for (string const &filename: filenames)
+    {
+        if (!filesystem::is_regular_file(filename))
+            throw runtime_error("No vault file “" + filename + "”");
+                                       // opening would create the file
+        string const stem = filesystem::path(filename).stem().string();
+        if (!stems.insert(stem).second)
+            clashes.insert(stem);
+    }
+
+    for (size_t idx = 0; idx != filenames.size(); ++idx)
+    {
+        string const stem = filesystem::path(filenames[idx]).stem().string();
+        d_mounts[idx].name = clashes.contains(stem) ? filenames[idx] : stem;
+    }
+                                       // cold files are read concurrently
+    d_pool.run(filenames.size(), [&](size_t idx)
+    {
+        d_mounts[idx].vault = make_unique<Vault>(filenames[idx]);
+        if (!d_mounts[idx].vault->isInitialized())
+            throw runtime_error("“" + filenames[idx] + "” is not a vault");
+    });
+}
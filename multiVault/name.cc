@@ -0,0 +1,6 @@
+#include "multiVault.ih"
+
+string const &MultiVault::name(size_t idx) const
+{
+    return d_mounts[idx].name;
+}
@@ -0,0 +1,24 @@
+#include "multiVault.ih"
+
+vector<MultiVault::Hit> MultiVault::search(string_view fragment,
+                                           size_t limit) const
+{
+    vector<vector<TrigramIndex::Match>> found(d_mounts.size());
+
+    d_pool.run(d_mounts.size(), [&](size_t idx)
+    {
+        if (d_mounts[idx].unlocked)
+            found[idx] = d_mounts[idx].vault->search(fragment, limit);
+    });
+
+    vector<Hit> hits;                  // mount order: ties keep it
+    for (size_t idx = 0; idx != d_mounts.size(); ++idx)
+        for (TrigramIndex::Match &match: found[idx])
+            hits.push_back({ d_mounts[idx].name, move(match) });
+
+    ranges::stable_sort(hits, greater{}, 
+                        [](Hit const &hit) { return hit.match.score; });
+    if (limit != 0 && hits.size() > limit)
+        hits.resize(limit);
+    return hits;
+}
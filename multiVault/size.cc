@@ -0,0 +1,6 @@
+#include "multiVault.ih"
+
+size_t MultiVault::size() const
+{
+    return d_mounts.size();
+}
@@ -0,0 +1,23 @@
+#include "multiVault.ih"
+
+size_t MultiVault::unlock(string &master)
+{
+    vector<size_t> locked;
+    for (size_t idx = 0; idx != d_mounts.size(); ++idx)
+        if (!d_mounts[idx].unlocked)
+            locked.push_back(idx);
+                                       // every vault wipes its own copy
+    vector<string> copies(locked.size(), master);
+    sodium_memzero(master.data(), master.size());
+
+    d_pool.run(locked.size(), [&](size_t task)
+    {
+        Mount &mount = d_mounts[locked[task]];
+        mount.unlocked = mount.vault->unlock(copies[task]);
+    });
+
+    size_t count = 0;
+    for (size_t idx: locked)
+        count += d_mounts[idx].unlocked;
+    return count;
+}
@@ -0,0 +1,8 @@
+#include "multiVault.ih"
+
+bool MultiVault::unlock(size_t idx, string &master)
+{
+    Mount &mount = d_mounts[idx];
+    mount.unlocked = mount.vault->unlock(master);
+    return mount.unlocked;
+}
@@ -0,0 +1,6 @@
+#include "multiVault.ih"
+
+bool MultiVault::unlocked(size_t idx) const
+{
+    return d_mounts[idx].unlocked;
+}
@@ -0,0 +1,22 @@
+#include "passwordGenerator.ih"
+
+vector<string> PasswordGenerator::alphabets(Policy const &policy)
+{
+    bool const enabled[] = { policy.lower, policy.upper,
+                             policy.digits, policy.symbols };
+
+    vector<string> classes;
+    for (size_t type = 0; type != CharClass::COUNT; ++type)
+    {
+        if (not enabled[type])
+            continue;
+
+        string &set = classes.emplace_back(CharClass::SETS[type]);
+        if (policy.noLookAlikes)
+            erase_if(set, [](char ch)
+                          {
+                              return CharClass::LOOK_ALIKES.contains(ch);
+                          });
+    }
+    return classes;
+}
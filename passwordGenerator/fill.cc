@@ -0,0 +1,30 @@
+#include "passwordGenerator.ih"
+
+void PasswordGenerator::fill(char *out, Policy const &policy,
+                             vector<string> const &classes,
+                             string const &all, RandomBytes &random)
+{
+    size_t const minimum[] = { policy.minLower, policy.minUpper,
+                               policy.minDigits, policy.minSymbols };
+    bool const enabled[] = { policy.lower, policy.upper,
+                             policy.digits, policy.symbols };
+
+    size_t length = 0;
+    size_t next = 0;                   // index in `classes`
+    for (size_t type = 0; type != size(enabled); ++type)
+    {
+        if (not enabled[type])
+            continue;
+                                       // each class's required characters
+        string const &chars = classes[next++];
+        for (size_t count = 0; count != minimum[type]; ++count)
+            out[length++] = chars[random.uniform(chars.size())];
+    }
+
+    for (; length != policy.length; ++length)
+        out[length] = all[random.uniform(all.size())];   // fill the rest
+
+                                       // shuffle with Fisher–Yates
+    for (size_t idx = policy.length; idx > 1; --idx)
+        swap(out[idx - 1], out[random.uniform(idx)]);
+}
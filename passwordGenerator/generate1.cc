@@ -0,0 +1,7 @@
+#include "passwordGenerator.ih"
+
+Secret PasswordGenerator::generate(Policy const &policy) const
+{
+    vector<Secret> passwords = generate(policy, 1);
+    return move(passwords.front());
+}
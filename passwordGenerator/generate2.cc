@@ -0,0 +1,26 @@
+#include "passwordGenerator.ih"
+
+vector<Secret> PasswordGenerator::generate(Policy const &policy,
+                                           size_t count) const
+{
+    policy.validate();
+
+    vector<string> const classes = alphabets(policy);
+    string all;
+    for (string const &chars: classes)
+        all += chars;
+                                       // one byte per pick and per shuffle
+                                       // step (two beyond 256 characters), 
+    size_t const width = policy.length > 256 ? 2 : 1;   // plus a margin 
+    size_t const expected = count * policy.length * width * 2;  // for the
+    RandomBytes random(expected + expected / 4 + 64);   // rejected bytes
+
+    vector<Secret> passwords;
+    passwords.reserve(count);
+    for (size_t idx = 0; idx != count; ++idx)
+    {
+        Secret &password = passwords.emplace_back(policy.length);
+        fill(password.buffer(), policy, classes, all, random);
+    }
+    return passwords;
+}
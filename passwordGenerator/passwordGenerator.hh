@@ -1,38 +1,97 @@
 #ifndef INCLUDED_PASSWORDGENERATOR_
 #define INCLUDED_PASSWORDGENERATOR_
 
-#include <sodium.h>
 #include <string>
+#include <vector>
+
+#include "../secret/secret.hh"
+
+class RandomBytes;
 
 /**
  * \brief Cryptographically secure password generator.
  *
- * Generates mixed-character passwords using libsodium's CSPRNG. Guarantees
- * inclusion of at least one character from each class (lower/upper/digit/symbol)
- * when length >= 4, then fills the remainder from the full alphabet and
- * shuffles with a Fisher–Yates permutation driven by `randombytes_uniform`.
+ * Generates passwords following a `Policy`: the characters of each enabled
+ * class (lower/upper/digit/symbol) minus, optionally, look-alikes. Every
+ * password starts with the required minimum of each class, is filled from
+ * the combined alphabet and is then shuffled (Fisher–Yates). All randomness
+ * of a call, for one password or a batch, comes from a single libsodium
+ * CSPRNG draw, rejection-sampled into the alphabets so no character is
+ * favoured. Policies known at compile time are better served by
+ * `PasswordPolicy`.
  */
 class PasswordGenerator
 {
     public:
+        enum
+        {                              // bounds the locked random buffer
+            MAX_LENGTH = 1024          // of a request (e.g. via the agent)
+        };
+
+        /**
+         * \brief Length and character composition of generated passwords.
+         *
+         * The minimum counts apply to enabled classes only.
+         */
+        struct Policy
+        {
+            size_t length = 20;
+            bool lower = true;
+            bool upper = true;
+            bool digits = true;
+            bool symbols = true;
+            bool noLookAlikes = false; // drop 0 O o 1 l I
+            size_t minLower = 1;
+            size_t minUpper = 1;
+            size_t minDigits = 1;
+            size_t minSymbols = 1;
+
+            /**
+             * Policy from "LENGTH [CLASSES] [x]": CLASSES is a subset of
+             * `luds` (lower, upper, digits, symbols; each enabled class is
+             * required once), `x` excludes look-alikes. Empty: the default.
+             * \throws std::invalid_argument on a malformed specification.
+             */
+            static Policy parse(std::string const &spec);
+
+            /**
+             * \throws std::invalid_argument if no class is enabled, the
+             *         required characters do not fit in `length` or it
+             *         exceeds MAX_LENGTH.
+             */
+            void validate() const;
+        };
+
         PasswordGenerator() = default;
 
         /**
-         * Generate a password of exactly `length` characters.
+         * Generate a password of exactly `length` characters with at least
+         * one character of each class.
          * \throws std::invalid_argument if `length < 4`.
          */
-        std::string generatePassword(size_t length) const;
+        Secret generatePassword(size_t length) const;
 
-    private:             
         /**
-         * Pick one uniformly from a NUL-terminated C-string constant.
-         *
-         * We sample from [0, N-2] to exclude the trailing '\0'.
-         */             
-        template <size_t N>
-        static char pickOne(char const (&set)[N]);
-};
+         * Generate one password following `policy`.
+         * \throws std::invalid_argument for an invalid policy.
+         */
+        Secret generate(Policy const &policy) const;
+
+        /**
+         * Generate `count` passwords following `policy`, from one CSPRNG 
+         * draw.
+         * \throws std::invalid_argument for an invalid policy.
+         */
+        std::vector<Secret> generate(Policy const &policy, size_t count) const;
 
-#include "pickOne.i"
+    private:
+        /** The enabled classes' characters, one string per class. */
+        static std::vector<std::string> alphabets(Policy const &policy);
+
+        /** Write one password of `policy.length` characters to `out`. */
+        static void fill(char *out, Policy const &policy,
+                         std::vector<std::string> const &classes,
+                         std::string const &all, RandomBytes &random);
+};
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,45 @@
+#include "passwordGenerator.ih"
+
+#include <sstream>
+
+PasswordGenerator::Policy PasswordGenerator::Policy::parse(string const &spec)
+{
+    Policy policy;
+    istringstream in(spec);
+
+    string length;
+    if (not (in >> length))
+        return policy;                 // empty: the default
+
+    size_t used = 0;
+    try
+    {
+        policy.length = stoul(length, &used);
+    }
+    catch (exception const &)
+    {}
+    if (used == 0 or used != length.size())
+        throw invalid_argument("Invalid password length: " + length);
+
+    string word;
+    while (in >> word)
+    {
+        if (word == "x")
+        {
+            policy.noLookAlikes = true;
+            continue;
+        }
+
+        if (word.find_first_not_of("luds") != string::npos)
+            throw invalid_argument("Invalid character classes: " + word + 
+                                   " (use a subset of luds)");
+
+        policy.lower   = word.contains('l');
+        policy.upper   = word.contains('u');
+        policy.digits  = word.contains('d');
+        policy.symbols = word.contains('s');
+    }
+
+    policy.validate();
+    return policy;
+}
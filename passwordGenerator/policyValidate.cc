@@ -0,0 +1,23 @@
+#include "passwordGenerator.ih"
+
+void PasswordGenerator::Policy::validate() const
+{
+    if (not (lower or upper or digits or symbols))
+        throw invalid_argument("A password policy needs at least one "
+                               "character class");
+
+    size_t const required = (lower   ? minLower   : 0)
+                          + (upper   ? minUpper   : 0)
+                          + (digits  ? minDigits  : 0)
+                          + (symbols ? minSymbols : 0);
+
+    if (length == 0 or required > length)
+        throw invalid_argument("Password length " + to_string(length) + 
+                               " cannot hold the " + to_string(required) + 
+                               " required characters");
+
+    if (length > MAX_LENGTH)
+        throw invalid_argument("Password length " + to_string(length) + 
+                               " exceeds the maximum of " + 
+                               to_string(MAX_LENGTH));
+}
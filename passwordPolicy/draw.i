@@ -0,0 +1,11 @@
+template <unsigned Classes, size_t MinLength, size_t MaxLength,
+          bool NoLookAlikes>
+inline char PasswordPolicy<Classes, MinLength, MaxLength, NoLookAlikes>::draw(
+                        CharClass::Sampler const &sampler, RandomBytes &random)
+{
+    char ch;
+    do                                 // '\0': the byte was in the biased
+        ch = sampler[random.byte()];   // top range
+    while (ch == 0);
+    return ch;
+}
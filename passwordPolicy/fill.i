@@ -0,0 +1,26 @@
+template <unsigned Classes, size_t MinLength, size_t MaxLength,
+          bool NoLookAlikes>
+void PasswordPolicy<Classes, MinLength, MaxLength, NoLookAlikes>::fill(
+                                            char *out, RandomBytes &random)
+{
+    static_assert(LENGTH <= 256, "Shuffling uses one random byte per step");
+    static constexpr std::array<uint16_t, LENGTH + 1> LIMITS =
+                                            CharClass::limits<LENGTH>();
+    size_t length = 0;
+    for (size_t type = 0; type != CharClass::COUNT; ++type)
+        if (Classes & (1u << type))    // each class is represented
+            out[length++] = draw(CLASS_SAMPLERS[type], random);
+
+    for (; length != LENGTH; ++length)
+        out[length] = draw(SAMPLER, random);
+
+                                       // shuffle with Fisher–Yates
+    for (size_t idx = LENGTH; idx > 1; --idx)
+    {
+        uint8_t byte;
+        do
+            byte = random.byte();
+        while (byte >= LIMITS[idx]);
+        std::swap(out[idx - 1], out[byte % idx]);
+    }
+}
@@ -0,0 +1,7 @@
+template <unsigned Classes, size_t MinLength, size_t MaxLength,
+          bool NoLookAlikes>
+Secret PasswordPolicy<Classes, MinLength, MaxLength, NoLookAlikes>::generate()
+{
+    std::vector<Secret> passwords = generate(1);
+    return std::move(passwords.front());
+}
@@ -0,0 +1,15 @@
+template <unsigned Classes, size_t MinLength, size_t MaxLength,
+          bool NoLookAlikes>
+std::vector<Secret> 
+    PasswordPolicy<Classes, MinLength, MaxLength, NoLookAlikes>::generate(
+                                                                size_t count)
+{                                      // a pick and a shuffle step per 
+    size_t const expected = count * LENGTH * 2;     // character, plus a 
+    RandomBytes random(expected + expected / 4 + 64);   // rejection margin
+
+    std::vector<Secret> passwords;
+    passwords.reserve(count);
+    for (size_t idx = 0; idx != count; ++idx)
+        fill(passwords.emplace_back(LENGTH).buffer(), random);
+    return passwords;
+}
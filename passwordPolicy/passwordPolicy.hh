@@ -0,0 +1,100 @@
+#ifndef INCLUDED_PASSWORDPOLICY_
+#define INCLUDED_PASSWORDPOLICY_
+
+#include <array>
+#include <bit>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../charClass/charClass.hh"
+#include "../passwordGenerator/passwordGenerator.hh"
+#include "../randomBytes/randomBytes.hh"
+#include "../secret/secret.hh"
+
+/**
+ * \brief Password policy fixed at compile time.
+ *
+ * `Classes` is a `CharClass` bitmask; passwords are `MinLength` to
+ * `MaxLength` characters long and contain at least one character of every
+ * class. Generated passwords take the full `MaxLength`; `MinLength` only
+ * bounds the passwords `satisfies` accepts. The alphabet, the class of
+ * every byte value and the byte -> character sampling tables (rejection
+ * bounds included) are constexpr, so generating and checking are table
+ * lookups, and a site-specific policy is one type alias:
+ *
+ *     using Bank = PasswordPolicy<CharClass::LOWER | CharClass::UPPER |
+ *                                 CharClass::DIGITS, 8, 16>;
+ *     Secret password = Bank::generate();
+ *     bool ok = Bank::satisfies(password.data());
+ */
+template <unsigned Classes, size_t MinLength, size_t MaxLength = MinLength,
+          bool NoLookAlikes = false>
+class PasswordPolicy
+{
+    static_assert(Classes != 0 and (Classes & ~CharClass::ALL) == 0,
+                  "Classes must be a non-empty set of CharClass flags");
+    static_assert(std::popcount(Classes) <= MinLength and 
+                  MinLength <= MaxLength,
+                  "MinLength must fit one character of every class and not "
+                  "exceed MaxLength");
+
+    public:
+        enum : size_t
+        {
+            LENGTH = MaxLength,        // of generated passwords
+            SIZE = CharClass::size(Classes, NoLookAlikes)
+        };
+
+        static constexpr std::array<char, SIZE> ALPHABET = 
+                            CharClass::alphabet<SIZE>(Classes, NoLookAlikes);
+
+        static constexpr std::array<uint8_t, 256> MEMBERSHIP =
+                            CharClass::membership(Classes, NoLookAlikes);
+
+        /** A password of `LENGTH` characters. */
+        static Secret generate();
+
+        /** `count` passwords of `LENGTH` characters, from one CSPRNG draw. */
+        static std::vector<Secret> generate(size_t count);
+
+        /**
+         * Whether `password` has an allowed length, only allowed characters
+         * and a character of every class.
+         */
+        static constexpr bool satisfies(std::string_view password);
+
+        /** The equivalent runtime policy. */
+        static PasswordGenerator::Policy policy();
+
+    private:
+        static constexpr CharClass::Sampler SAMPLER =
+                            CharClass::sampler(Classes, NoLookAlikes);
+                                       // one per class, empty if disabled
+        static constexpr std::array<CharClass::Sampler, CharClass::COUNT>
+            CLASS_SAMPLERS =
+            {
+                CharClass::sampler(Classes & CharClass::LOWER, NoLookAlikes),
+                CharClass::sampler(Classes & CharClass::UPPER, NoLookAlikes),
+                CharClass::sampler(Classes & CharClass::DIGITS, NoLookAlikes),
+                CharClass::sampler(Classes & CharClass::SYMBOLS, NoLookAlikes)
+            };
+
+        /** One accepted character from `sampler`. */
+        static char draw(CharClass::Sampler const &sampler, 
+                         RandomBytes &random);
+
+        /** Write `LENGTH` characters to `out`. */
+        static void fill(char *out, RandomBytes &random);
+};
+                                       // the generator's default
+using DefaultPolicy = PasswordPolicy<CharClass::ALL, 20>;
+
+#include "draw.i"
+#include "fill.i"
+#include "generate1.i"
+#include "generate2.i"
+#include "satisfies.i"
+#include "policy.i"
+
+#endif
@@ -0,0 +1,14 @@
+template <unsigned Classes, size_t MinLength, size_t MaxLength,
+          bool NoLookAlikes>
+PasswordGenerator::Policy 
+    PasswordPolicy<Classes, MinLength, MaxLength, NoLookAlikes>::policy()
+{
+    PasswordGenerator::Policy policy;
+    policy.length  = LENGTH;
+    policy.lower   = Classes & CharClass::LOWER;
+    policy.upper   = Classes & CharClass::UPPER;
+    policy.digits  = Classes & CharClass::DIGITS;
+    policy.symbols = Classes & CharClass::SYMBOLS;
+    policy.noLookAlikes = NoLookAlikes;
+    return policy;
+}
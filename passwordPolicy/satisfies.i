@@ -0,0 +1,17 @@
+template <unsigned Classes, size_t MinLength, size_t MaxLength,
+          bool NoLookAlikes>
+constexpr bool 
+    PasswordPolicy<Classes, MinLength, MaxLength, NoLookAlikes>::satisfies(
+                                                    std::string_view password)
+{
+    unsigned seen = 0;                 // classes present
+    bool foreign = false;              // any character outside them
+    for (unsigned char ch: password)
+    {
+        seen |= MEMBERSHIP[ch];
+        foreign |= MEMBERSHIP[ch] == 0;
+    }
+                                       // unsigned wrap-around: one test
+    return (password.size() - MinLength <= MaxLength - MinLength) 
+           & not foreign & (seen == Classes);
+}
@@ -0,0 +1,6 @@
+#include "perfectHash.ih"
+
+size_t PerfectHash::buckets(size_t count)
+{
+    return (count + BUCKET_LOAD - 1) / BUCKET_LOAD;
+}
@@ -0,0 +1,16 @@
+#include "perfectHash.ih"
+
+pair<uint64_t, vector<uint32_t>> PerfectHash::build(span<Hash const> keys)
+{
+    if (keys.empty())
+        return { 0, {} };
+
+    for (uint64_t seed = 0; seed != MAX_SEEDS; ++seed)
+    {
+        vector<uint32_t> displacements = tryBuild(keys, seed);
+        if (!displacements.empty())
+            return { seed, move(displacements) };
+    }
+    throw runtime_error("Perfect hash: no seed separates the keys "
+                        "(duplicates?)");
+}
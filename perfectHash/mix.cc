@@ -0,0 +1,8 @@
+#include "perfectHash.ih"
+
+uint64_t PerfectHash::mix(uint64_t value)
+{
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+    return value ^ (value >> 31);
+}
@@ -0,0 +1,88 @@
+#ifndef INCLUDED_PERFECTHASH_
+#define INCLUDED_PERFECTHASH_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+/**
+ * \brief Minimal perfect hash over 128-bit keys (hash and displace).
+ *
+ * The `count` keys are spread over `buckets(count)` buckets of about 
+ * BUCKET_LOAD keys. Each bucket stores one 32-bit displacement `d`, chosen
+ * while building so that the keys of the bucket land on distinct, free slots
+ * `(base + mix(step + d)) % count`, where `base` and `step` are mixed from
+ * the key and a seed. Successive displacements probe pseudo-random slots,
+ * so filling the last free slots does not degrade into linear probing. A
+ * lookup is one bucket read and a few multiplications; the table costs 
+ * 32 / BUCKET_LOAD bits per key. Keys that were not in the set map to an
+ * arbitrary slot, so callers compare the key stored there.
+ *
+ * Lookups only view the displacements, which can live in a memory-mapped
+ * file.
+ */
+class PerfectHash
+{
+    std::uint64_t d_seed;
+    std::size_t d_count;
+    std::span<std::uint32_t const> d_displacements;   // one per bucket
+
+    public:
+        enum
+        {
+            BUCKET_LOAD = 4,           // average keys per bucket
+            MAX_SEEDS   = 64           // build attempts
+        };
+
+        using Hash = std::array<std::uint64_t, 2>;
+
+        /** A lookup over the `count` keys `build` returned 
+         *  `seed`/`displacements` for; `displacements` must outlive it.*/
+        PerfectHash(std::uint64_t seed, std::size_t count, 
+                    std::span<std::uint32_t const> displacements);
+
+        /** Number of buckets (and displacements) for `count` keys.*/
+        static std::size_t buckets(std::size_t count);
+
+        /**
+         * The seed and displacements mapping the distinct, uniformly 
+         * distributed `keys` one-to-one onto [0, keys.size()).
+         * \throws std::runtime_error if no seed works (duplicate keys).
+         */
+        static std::pair<std::uint64_t, std::vector<std::uint32_t>> 
+                                            build(std::span<Hash const> keys);
+
+        /** Slot in [0, count) of `key`; `count` must not be 0.*/
+        std::size_t slot(Hash const &key) const;
+
+    private:
+        struct Place
+        {
+            std::uint64_t bucket;
+            std::uint64_t base;
+            std::uint64_t step;
+        };
+
+        /** Bucket, base and step of `key` under `seed`.*/
+        static Place place(Hash const &key, std::uint64_t seed, 
+                           std::size_t count);
+
+        /** splitmix64's finalizer.*/
+        static std::uint64_t mix(std::uint64_t value);
+
+        /** Slot of a key at `where` with displacement `displacement`.*/
+        static std::size_t position(Place const &where, 
+                                    std::uint64_t displacement,
+                                    std::size_t count);
+
+        /** Displacements for `seed`; empty if some bucket cannot be 
+         *  placed.*/
+        static std::vector<std::uint32_t> tryBuild(
+                                            std::span<Hash const> keys,
+                                            std::uint64_t seed);
+};
+
+#endif
@@ -0,0 +1,12 @@
+#include "perfectHash.ih"
+
+PerfectHash::PerfectHash(uint64_t seed, size_t count, 
+                         span<uint32_t const> displacements)
+:
+    d_seed(seed),
+    d_count(count),
+    d_displacements(displacements)
+{
+    if (displacements.size() != buckets(count))
+        throw runtime_error("Perfect hash: wrong number of displacements");
+}
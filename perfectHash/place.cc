@@ -0,0 +1,9 @@
+#include "perfectHash.ih"
+
+PerfectHash::Place PerfectHash::place(Hash const &key, uint64_t seed, 
+                                      size_t count)
+{                                      // a new seed gives new places, even
+    uint64_t const low = mix(key[0] ^ seed);  // to colliding (base, step)
+    uint64_t const high = mix(key[1] + seed);
+    return { low % buckets(count), high % count, mix(low ^ high) };
+}
@@ -0,0 +1,7 @@
+#include "perfectHash.ih"
+
+size_t PerfectHash::position(Place const &where, uint64_t displacement,
+                             size_t count)
+{                                      // keys of a bucket with different
+    return (where.base + mix(where.step + displacement)) % count;  // steps
+}                                      // probe independently
@@ -0,0 +1,7 @@
+#include "perfectHash.ih"
+
+size_t PerfectHash::slot(Hash const &key) const
+{
+    Place const where = place(key, d_seed, d_count);
+    return position(where, d_displacements[where.bucket], d_count);
+}
@@ -0,0 +1,67 @@
+#include "perfectHash.ih"
+
+vector<uint32_t> PerfectHash::tryBuild(span<Hash const> keys, uint64_t seed)
+{
+    size_t const count = keys.size();
+    size_t const nBuckets = buckets(count);
+
+    vector<Place> places(count);
+    vector<size_t> start(nBuckets + 1);// counting sort of keys by bucket
+    for (size_t idx = 0; idx != count; ++idx)
+    {
+        places[idx] = place(keys[idx], seed, count);
+        ++start[places[idx].bucket + 1];
+    }
+    partial_sum(start.begin(), start.end(), start.begin());
+
+    vector<uint32_t> members(count);
+    {
+        vector<size_t> next(start.begin(), start.end() - 1);
+        for (size_t idx = 0; idx != count; ++idx)
+            members[next[places[idx].bucket]++] = idx;
+    }
+                                       // largest buckets first, while the
+    vector<uint32_t> order(nBuckets);  // table is still empty
+    iota(order.begin(), order.end(), 0);
+    stable_sort(order.begin(), order.end(), [&](uint32_t lhs, uint32_t rhs)
+    {
+        return start[lhs + 1] - start[lhs] > start[rhs + 1] - start[rhs];
+    });
+                                       // the last free slot is missed by
+    uint64_t const limit = min<uint64_t>(     // 64 * count probes with
+                                numeric_limits<uint32_t>::max(),   // odds
+                                64 * static_cast<uint64_t>(count));// e^-64
+    vector<uint32_t> displacements(nBuckets);
+    vector<bool> taken(count);
+    vector<size_t> slots;
+    for (uint32_t bucket: order)
+    {
+        span<uint32_t const> const inBucket(members.data() + start[bucket],
+                                            start[bucket + 1] - start[bucket]);
+        if (inBucket.empty())
+            break;                     // sorted: only empty ones follow
+
+        uint64_t displacement = 0;
+        for (; displacement != limit; ++displacement)
+        {
+            slots.clear();
+            for (uint32_t member: inBucket)
+            {
+                size_t const slot = position(places[member], displacement,
+                                             count);
+                if (taken[slot] || ranges::find(slots, slot) != slots.end())
+                    break;
+                slots.push_back(slot);
+            }
+            if (slots.size() == inBucket.size())
+                break;
+        }
+        if (displacement == limit)
+            return {};
+
+        displacements[bucket] = displacement;
+        for (size_t slot: slots)
+            taken[slot] = true;
+    }
+    return displacements;
+}
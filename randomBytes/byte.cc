@@ -0,0 +1,6 @@
+#include "randomBytes.ih"
+
+uint8_t RandomBytes::byte()
+{
+    return take(1);
+}
@@ -0,0 +1,38 @@
+#ifndef INCLUDED_RANDOMBYTES_
+#define INCLUDED_RANDOMBYTES_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../secureAllocator/secureAllocator.hh"
+
+/**
+ * \brief Block of CSPRNG output consumed by rejection sampling.
+ *
+ * The constructor fills the block with one `randombytes_buf` call; 
+ * `uniform` then takes 1, 2 or 4 bytes per candidate, depending on the
+ * bound, and rejects candidates from the incomplete top range so the
+ * results are unbiased. Should the block run out, it is refilled. The
+ * block lives in secure memory: its bytes determine secrets.
+ */
+class RandomBytes
+{
+    SecureBytes d_buffer;
+    size_t d_next = 0;                 // first unused byte
+
+    public:
+        /** Draw `expected` bytes up front; 0 is treated as 1. */
+        explicit RandomBytes(size_t expected);
+
+        /** Uniformly distributed value in [0, bound), bound > 0. */
+        uint32_t uniform(uint32_t bound);
+
+        /** The next random byte, for callers doing their own sampling. */
+        uint8_t byte();
+
+    private:
+        /** The next `width` bytes as a little-endian number. */
+        uint32_t take(size_t width);
+};
+
+#endif
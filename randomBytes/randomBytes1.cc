@@ -0,0 +1,8 @@
+#include "randomBytes.ih"
+
+RandomBytes::RandomBytes(size_t expected)
+:
+    d_buffer(max<size_t>(expected, 1))
+{
+    randombytes_buf(d_buffer.data(), d_buffer.size());
+}
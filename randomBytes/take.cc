@@ -0,0 +1,15 @@
+#include "randomBytes.ih"
+
+uint32_t RandomBytes::take(size_t width)
+{
+    if (d_buffer.size() - d_next < width)
+    {                                  // rare: more rejections than the
+        randombytes_buf(d_buffer.data(), d_buffer.size());  // caller 
+        d_next = 0;                    // expected
+    }
+
+    uint32_t value = 0;
+    for (size_t idx = 0; idx != width; ++idx)
+        value |= uint32_t{ d_buffer[d_next++] } << (8 * idx);
+    return value;
+}
@@ -0,0 +1,16 @@
+#include "randomBytes.ih"
+
+uint32_t RandomBytes::uniform(uint32_t bound)
+{
+    size_t const width = bound <= 1u << 8  ? 1 
+                       : bound <= 1u << 16 ? 2 : 4;
+    uint64_t const range = uint64_t{ 1 } << (8 * width);
+                                       // largest multiple of `bound` in the
+    uint64_t const limit = range - range % bound;   // range: accept below
+    for (;;)
+    {
+        uint32_t const value = take(width);
+        if (value < limit)
+            return value % bound;
+    }
+}
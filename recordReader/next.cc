@@ -0,0 +1,49 @@
+#include "recordReader.ih"
+
+namespace
+{
+    void wipe(vector<string> &fields)
+    {
+        for (string &field: fields)
+            sodium_memzero(field.data(), field.size());
+    }
+
+    bool isHeader(vector<string> const &fields)
+    {
+        string first = fields.front();
+        for (char &ch: first)
+            ch = static_cast<char>(tolower(static_cast<unsigned char>(ch)));
+        return first == "website";
+    }
+}
+
+optional<Credential> RecordReader::next()
+{
+    vector<string> fields;
+    while (d_format == CSV ? readCsv(fields) : readNul(fields))
+    {
+        ++d_record;
+        if (d_format == CSV)
+        {
+            if (fields.size() == 1 && fields.front().empty())
+                continue;              // blank line
+            if (d_record == 1 && isHeader(fields))
+                continue;
+        }
+
+        if (fields.size() != 3 
+            || fields[0].empty() || fields[1].empty() || fields[2].empty())
+        {
+            wipe(fields);
+            throw runtime_error("Malformed record " + to_string(d_record) 
+                                + ": expected website, user and password");
+        }
+
+        Credential credential{ move(fields[0]), move(fields[1]), 
+                               Secret{ move(fields[2]) } };
+        wipe(fields);
+        return credential;
+    }
+
+    return nullopt;
+}
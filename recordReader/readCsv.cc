@@ -0,0 +1,51 @@
+#include "recordReader.ih"
+
+bool RecordReader::readCsv(vector<string> &fields)
+{
+    fields.assign(1, string{});
+
+    bool quoted = false;
+    bool any = false;
+    for (int ch; (ch = d_in.get()) != EOF; )
+    {
+        any = true;
+        if (quoted)
+        {
+            if (ch != '"')
+                fields.back().push_back(static_cast<char>(ch));
+            else if (d_in.peek() == '"')   // "" inside quotes: a literal quote
+                fields.back().push_back(static_cast<char>(d_in.get()));
+            else
+                quoted = false;
+            continue;
+        }
+
+        switch (ch)
+        {
+            case '"':
+                quoted = true;
+            break;
+
+            case ',':
+                fields.emplace_back();
+            break;
+
+            case '\r':                 // a CRLF line end; a lone CR is
+                if (d_in.peek() != '\n')   // data
+                    fields.back().push_back('\r');
+            break;
+
+            case '\n':
+            return true;
+
+            default:
+                fields.back().push_back(static_cast<char>(ch));
+            break;
+        }
+    }
+
+    if (quoted)
+        throw runtime_error("Unterminated quoted field in record " 
+                            + to_string(d_record + 1));
+    return any;
+}
@@ -0,0 +1,26 @@
+#include "recordReader.ih"
+
+namespace
+{
+    enum
+    {
+        FIELDS = 3
+    };
+}
+
+bool RecordReader::readNul(vector<string> &fields)
+{
+    fields.assign(FIELDS, string{});
+
+    for (size_t idx = 0; idx != FIELDS; ++idx)
+    {
+        if (!getline(d_in, fields[idx], '\0'))
+        {
+            if (idx == 0)              // clean end of input
+                return false;
+            throw runtime_error("Truncated record " + to_string(d_record + 1));
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,58 @@
+#ifndef INCLUDED_RECORDREADER_
+#define INCLUDED_RECORDREADER_
+
+#include <istream>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "../credential/credential.hh"
+
+/**
+ * \brief Streams credentials out of an import file.
+ *
+ * Two input formats are understood:
+ *
+ *  - `CSV`: one `website,user,password` record per line (RFC 4180 quoting,
+ *    so fields may contain commas, quotes and newlines). Blank lines and a
+ *    leading `website,...` header line are skipped.
+ *
+ *  - `NUL`: `website\0user\0password\0` records, as produced by e.g.
+ *    `find -print0`-style tooling; fields may contain anything but NUL.
+ *
+ * Field buffers are wiped once their contents have been moved into the
+ * returned `Credential`.
+ */
+class RecordReader
+{
+    public:
+        enum Format
+        {
+            CSV,
+            NUL
+        };
+
+    private:
+        std::istream &d_in;
+        Format d_format;
+        size_t d_record = 0;           // records read so far (for messages)
+
+    public:
+        RecordReader(std::istream &in, Format format);
+
+        /**
+         * Return the next credential, or nullopt at end of input.
+         * \throws std::runtime_error on a malformed or truncated record.
+         */
+        std::optional<Credential> next();
+
+    private:
+        /** Read one CSV record into `fields`; false at end of input. */
+        bool readCsv(std::vector<std::string> &fields);
+
+        /** Read one NUL-delimited record into `fields`; false at end of 
+         *  input. */
+        bool readNul(std::vector<std::string> &fields);
+};
+
+#endif
@@ -0,0 +1,7 @@
+#include "recordReader.ih"
+
+RecordReader::RecordReader(istream &in, Format format)
+:
+    d_in(in),
+    d_format(format)
+{}
@@ -0,0 +1,62 @@
+#include "main.ih"
+
+namespace
+{
+    enum
+    {
+        DEFAULT_IDLE_MINUTES = 15,
+        MAX_IDLE_MINUTES = 7 * 24 * 60,     // a week
+        MAX_CACHE_ENTRIES = 4096,      // of 256 locked bytes each
+        CACHE_TTL_SECONDS = 300        // of a cached secret
+    };
+                                       // stoul alone takes "-1" as 
+    size_t number(char const *arg, size_t max, char const *what)  // ULONG_MAX
+    {
+        string const text = arg;
+        if (text.empty() || text.find_first_not_of("0123456789") 
+                                                        != string::npos
+            || text.size() > 9 || stoul(text) > max)
+            throw invalid_argument("The " + string(what) + " must be a "
+                                   "number from 0 to " + to_string(max));
+        return stoul(text);
+    }
+}
+                                       // main agent [idle-minutes 
+int runAgent(int argc, char *argv[])   //             [cache-entries]]
+{
+    chrono::minutes const idle{ 
+            argc > 2 ? number(argv[2], MAX_IDLE_MINUTES, "idle time") 
+                     : static_cast<size_t>(DEFAULT_IDLE_MINUTES) };
+    size_t const cacheEntries = 
+            argc > 3 ? number(argv[3], MAX_CACHE_ENTRIES, "cache size") : 0;
+
+    StatsGuard const statsGuard;       // also if serving fails
+
+    Vault vault;
+    if (!vault.isInitialized())
+        throw runtime_error("There is no vault yet: run without arguments "
+                            "to create one.");
+    vault.unlock();
+    loadBreaches(vault);
+
+    if (cacheEntries != 0)
+        vault.enableCache(cacheEntries, chrono::seconds(CACHE_TTL_SECONDS));
+
+    string const path = Agent::defaultPath();
+    Agent agent(vault, path, idle);
+
+    cout << "Agent listening on " << path << " (idle timeout " 
+         << idle.count() << " min).\n"
+         << "CERBERUS_AGENT_SOCK=" << path 
+         << "; export CERBERUS_AGENT_SOCK;" << endl;
+
+    agent.serve();
+
+    if (cacheEntries != 0)
+    {
+        SecretCache::Stats const stats = vault.cacheStats();
+        cout << "Cache: " << stats.hits << " hits, " << stats.misses 
+             << " misses.\n";
+    }
+    return 0;
+}
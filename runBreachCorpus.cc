@@ -0,0 +1,26 @@
+#include "main.ih"
+                                       // main breach-corpus PASSWORDS CORPUS
+int runBreachCorpus(int argc, char *argv[])
+{
+    if (argc != 4)
+    {
+        cerr << "usage: main breach-corpus PASSWORDS CORPUS\n"
+                "       (PASSWORDS: one per line, - for standard input)\n";
+        return 2;
+    }
+
+    string const source = argv[2];
+    ifstream file;
+    if (source != "-")
+    {
+        file.open(source, ios::binary);
+        if (!file)
+            throw runtime_error("Cannot open " + source);
+    }
+
+    size_t const count = BreachIndex::create(source == "-" ? cin : file, 
+                                             argv[3]);
+    cout << "✓ Wrote " << count << " password hashes to " << argv[3] 
+         << ".\n";
+    return 0;
+}
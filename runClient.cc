@@ -0,0 +1,80 @@
+#include "main.ih"
+
+namespace
+{
+    int usage()
+    {
+        cerr << "usage: main                          interactive session\n"
+                "       main agent [idle-minutes [cache-entries]]\n"
+                "                                     unlock once, then serve "
+                                                     "requests\n"
+                "       main get WEBSITE USER         fetch via the agent\n"
+                "       main add WEBSITE USER [LEN [luds] [x]]\n"
+                "                                     generate and store via "
+                                                     "the agent\n"
+                "       main stats                    the agent's stage "
+                                                     "latencies\n"
+                "       main lock                     wipe the agent's key "
+                                                     "and stop it\n"
+                "       main find WEBSITE USER VAULT...\n"
+                "                                     look up in several "
+                                                     "vault files\n"
+                "       main search FRAGMENT VAULT... search several vault "
+                                                     "files\n"
+                "       main restore ARCHIVE [VAULT]  restore a backup as a "
+                                                     "new vault file\n"
+                "       main snapshot FILE WEBSITE USER\n"
+                "                                     fetch from a snapshot "
+                                                     "file\n"
+                "       main breach-corpus PASSWORDS CORPUS\n"
+                "                                     write a breach corpus "
+                                                     "for add and audit\n";
+        return 2;
+    }
+}
+                                       // main get|add|lock ...
+int runClient(int argc, char *argv[])
+{
+    string const command = argv[1];
+    string policy = to_string(PASSWORD_LENGTH);
+    if (argc > 4)                      // LEN [luds] [x]: a policy spec
+    {
+        policy = argv[4];
+        for (int idx = 5; idx < argc; ++idx)
+            policy += ' ' + string(argv[idx]);
+    }
+
+    if (!((command == "get" && argc == 4) 
+          || (command == "add" && argc >= 4 && argc <= 7)
+          || ((command == "lock" || command == "stats") && argc == 2)))
+        return usage();
+
+    Channel channel = Channel::connect(Agent::defaultPath());
+    if (command == "get")
+        channel.send(Agent::GET, { argv[2], argv[3] });
+    else if (command == "add")
+        channel.send(Agent::ADD, { argv[2], argv[3], policy });
+    else if (command == "stats")
+        channel.send(Agent::STATS, {});
+    else
+        channel.send(Agent::LOCK, {});
+
+    char code;
+    vector<string> fields;
+    if (!channel.receive(code, fields))
+        throw runtime_error("The agent closed the connection");
+
+    if (code != Agent::OK)
+    {
+        cerr << (fields.empty() ? "The agent refused the request" 
+                                : fields.front()) << '\n';
+        return 1;
+    }
+
+    if (!fields.empty())               // the password, for scripts to read,
+    {                                  // or the statistics
+        cout << fields.front() << '\n';
+        sodium_memzero(fields.front().data(), fields.front().size());
+    }
+    return 0;
+}
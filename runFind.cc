@@ -0,0 +1,25 @@
+#include "main.ih"
+                                       // main find WEBSITE USER VAULT...
+int runFind(int argc, char *argv[])
+{
+    if (argc < 5)
+    {
+        cerr << "usage: main find WEBSITE USER VAULT...\n";
+        return 2;
+    }
+
+    MultiVault vaults(vector<string>(argv + 4, argv + argc));
+    unlockVaults(vaults);
+
+    vector<MultiVault::Match> const matches = vaults.get(argv[2], argv[3]);
+    for (MultiVault::Match const &match: matches)
+        cout << match.vault << '\t' << match.password.data() << '\n';
+
+    if (matches.empty())
+    {
+        cerr << "No password stored for “" << argv[2] << "” / user “" 
+             << argv[3] << "” in the unlocked vaults.\n";
+        return 1;
+    }
+    return 0;
+}
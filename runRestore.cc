@@ -0,0 +1,17 @@
+#include "main.ih"
+                                       // main restore ARCHIVE [VAULT]
+int runRestore(int argc, char *argv[])
+{
+    if (argc < 3 || argc > 4)
+    {
+        cerr << "usage: main restore ARCHIVE [VAULT]\n";
+        return 2;
+    }
+
+    string const filename = argc == 4 ? argv[3] : "vault.db";
+    string password = IOTools::hiddenPrompt("Backup password: ");
+    size_t const size = Vault::restore(argv[2], filename, password);
+
+    cout << "✓ Restored " << size << " bytes to " << filename << ".\n";
+    return 0;
+}
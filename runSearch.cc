@@ -0,0 +1,27 @@
+#include "main.ih"
+                                       // main search FRAGMENT VAULT...
+int runSearch(int argc, char *argv[])
+{
+    if (argc < 4)
+    {
+        cerr << "usage: main search FRAGMENT VAULT...\n";
+        return 2;
+    }
+
+    MultiVault vaults(vector<string>(argv + 3, argv + argc));
+    unlockVaults(vaults);
+
+    vector<MultiVault::Hit> const hits = vaults.search(argv[2]);
+    for (MultiVault::Hit const &hit: hits)
+        cout << (hit.match.score < 1 ? "~ " : "  ")  // ~: fuzzy match
+             << hit.vault << '\t' << hit.match.website << '\t' 
+             << hit.match.userIdentifier << '\n';
+
+    if (hits.empty())
+    {
+        cerr << "Nothing matches “" << argv[2] 
+             << "” in the unlocked vaults.\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,22 @@
+#include "main.ih"
+                                       // main snapshot FILE WEBSITE USER
+int runSnapshot(int argc, char *argv[])
+{
+    if (argc != 5)
+    {
+        cerr << "usage: main snapshot FILE WEBSITE USER\n";
+        return 2;
+    }
+
+    SnapshotVault snapshot(argv[2]);
+    string master = IOTools::hiddenPrompt("Master password: ");
+    if (!snapshot.unlock(master))
+    {
+        cerr << "Incorrect password.\n";
+        return 1;
+    }
+
+    Secret const password = snapshot.get(argv[3], argv[4]);
+    cout << password.data() << '\n';
+    return 0;
+}
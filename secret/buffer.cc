@@ -0,0 +1,6 @@
+#include "secret.ih"
+
+char *Secret::buffer()
+{
+    return d_data.data();
+}
@@ -1,6 +1,6 @@
 #include "secret.ih"
 
-string const &Secret::data() const
+string_view Secret::data() const
 {
-    return d_data;
-}
\ No newline at end of file
+    return { d_data.data(), d_data.size() };
+}
@@ -2,21 +2,32 @@
 #define INCLUDED_SECRET_
 
 #include <string>
+#include <string_view>
+#include <vector>
+
+#include "../secureAllocator/secureAllocator.hh"
 
 /**
  * \brief Move-only wrapper for sensitive string data with zeroization.
  *
- * Holds a secret in memory and attempts to scrub it (via `sodium_memzero`) on
- * destruction or reassignment. Copy is disabled to avoid accidental duplication
- * of sensitive data. Move operations transfer ownership.
+ * Holds a secret in the `SecureArena` (locked memory, in chunks framed by
+ * guard pages, not a pair per secret) and scrubs it (via `sodium_memzero`)
+ * on destruction or reassignment. Copy is disabled 
+ * to avoid accidental duplication of sensitive data. Move operations 
+ * transfer ownership of the buffer.
  */
 class Secret
 {
-    std::string d_data;
+    std::vector<char, SecureAllocator<char>> d_data;
 
     public:
         Secret() = delete;
+        /** Copy `secret` into secure memory and wipe it. */
         explicit Secret(std::string &&secret);
+        /** Copy `secret` into secure memory. */
+        explicit Secret(std::string_view secret);
+        /** `size` zero bytes, to be filled through `buffer()`. */
+        explicit Secret(size_t size);
 
         Secret(Secret const &other) = delete;
         Secret(Secret &&tmp);
@@ -27,11 +38,17 @@ class Secret
         ~Secret();
 
         /** Read-only access to the underlying data. */
-        std::string const &data() const;
+        std::string_view data() const;
+
+        /** Writable access to the underlying bytes. */
+        char *buffer();
+
+        /** Number of bytes held. */
+        size_t size() const;
 
     private:
         /** Best-effort zeroization followed by logical clearing. */
         void wipe();
 };
 
-#endif
\ No newline at end of file
+#endif
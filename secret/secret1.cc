@@ -2,5 +2,8 @@
 
 Secret::Secret(string &&secret)
 :
-    d_data(move(secret))
-{}
\ No newline at end of file
+    d_data(secret.begin(), secret.end())
+{                                      // only the secure copy remains
+    sodium_memzero(secret.data(), secret.size());
+    secret.clear();
+}
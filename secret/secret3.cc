@@ -0,0 +1,6 @@
+#include "secret.ih"
+
+Secret::Secret(string_view secret)
+:
+    d_data(secret.begin(), secret.end())
+{}
@@ -0,0 +1,6 @@
+#include "secret.ih"
+
+Secret::Secret(size_t size)
+:
+    d_data(size)
+{}
@@ -0,0 +1,6 @@
+#include "secret.ih"
+
+size_t Secret::size() const
+{
+    return d_data.size();
+}
@@ -0,0 +1,10 @@
+#include "secretCache.ih"
+
+void SecretCache::clear()
+{
+    lock_guard lock(d_mutex);
+    ++d_generation;
+
+    while (!d_recent.empty())
+        release(d_recent.front());
+}
@@ -0,0 +1,6 @@
+#include "secretCache.ih"
+
+SecretCache::~SecretCache()
+{                                      // sodium_free zeroizes the region
+    sodium_free(d_memory);
+}
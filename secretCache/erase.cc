@@ -0,0 +1,10 @@
+#include "secretCache.ih"
+
+void SecretCache::erase(string_view name)
+{
+    lock_guard lock(d_mutex);
+    ++d_generation;
+
+    if (auto const found = d_index.find(name); found != d_index.end())
+        release(found->second);
+}
@@ -0,0 +1,27 @@
+#include "secretCache.ih"
+
+optional<Secret> SecretCache::find(string_view name)
+{
+    lock_guard lock(d_mutex);
+
+    auto const found = d_index.find(name);
+    if (found == d_index.end())
+    {
+        ++d_misses;
+        return nullopt;
+    }
+
+    size_t const idx = found->second;
+    Slot &entry = d_slots[idx];
+    if (chrono::steady_clock::now() >= entry.expires)
+    {
+        release(idx);
+        ++d_misses;
+        return nullopt;
+    }
+                                       // now the most recently used
+    d_recent.splice(d_recent.begin(), d_recent, entry.position);
+    ++d_hits;
+    return Secret(string_view(reinterpret_cast<char const *>(slot(idx)), 
+                              entry.length));
+}
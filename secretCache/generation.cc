@@ -0,0 +1,7 @@
+#include "secretCache.ih"
+
+uint64_t SecretCache::generation() const
+{
+    lock_guard lock(d_mutex);
+    return d_generation;
+}
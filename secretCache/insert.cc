@@ -0,0 +1,30 @@
+#include "secretCache.ih"
+
+void SecretCache::insert(string_view name, string_view secret,
+                         uint64_t generation)
+{
+    if (secret.size() > d_slotSize)
+        return;
+
+    lock_guard lock(d_mutex);
+    if (generation != d_generation)    // invalidated while being fetched
+        return;
+
+    if (auto const found = d_index.find(name); found != d_index.end())
+        release(found->second);
+    else if (d_free.empty())           // evict the least recently used
+        release(d_recent.back());
+
+    size_t const idx = d_free.back();
+    d_free.pop_back();
+
+    Slot &entry = d_slots[idx];
+    entry.name = name;
+    entry.length = secret.size();
+    entry.expires = chrono::steady_clock::now() + d_ttl;
+    d_recent.push_front(idx);
+    entry.position = d_recent.begin();
+    d_index.emplace(name, idx);
+
+    memcpy(slot(idx), secret.data(), secret.size());
+}
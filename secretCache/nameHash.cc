@@ -0,0 +1,6 @@
+#include "secretCache.ih"
+
+size_t SecretCache::NameHash::operator()(string_view name) const
+{
+    return hash<string_view>{}(name);
+}
@@ -0,0 +1,13 @@
+#include "secretCache.ih"
+
+void SecretCache::release(size_t idx)
+{
+    Slot &entry = d_slots[idx];
+    sodium_memzero(slot(idx), entry.length);
+
+    d_index.erase(entry.name);
+    d_recent.erase(entry.position);
+    entry.name.clear();
+    entry.length = 0;
+    d_free.push_back(idx);
+}
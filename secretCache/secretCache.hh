@@ -0,0 +1,112 @@
+#ifndef INCLUDED_SECRETCACHE_
+#define INCLUDED_SECRETCACHE_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "../secret/secret.hh"
+
+/**
+ * \brief Size-bounded LRU cache of decrypted secrets with a per-entry TTL.
+ *
+ * The secrets live in one `sodium_allocarray` region of fixed-size slots:
+ * locked into RAM, surrounded by guard pages and zeroized when an entry is
+ * evicted, erased, expires or the cache is cleared. Only the lookup names
+ * and slot bookkeeping live in ordinary memory. Secrets longer than a slot
+ * are not cached. All members are thread-safe.
+ *
+ * To keep a lookup that raced with an invalidation from re-inserting a 
+ * stale secret, `insert` takes the `generation()` read before the secret 
+ * was fetched and ignores the secret if anything was erased since.
+ */
+class SecretCache
+{
+    struct NameHash                    // lookups by string_view
+    {
+        using is_transparent = void;
+        size_t operator()(std::string_view name) const;
+    };
+
+    struct Slot
+    {
+        std::string name;
+        size_t length = 0;
+        std::chrono::steady_clock::time_point expires;
+        std::list<size_t>::iterator position;   // in d_recent
+    };
+
+    size_t d_slotSize;
+    std::chrono::seconds d_ttl;
+    unsigned char *d_memory;           // capacity * slotSize secret bytes
+
+    mutable std::mutex d_mutex;
+    std::vector<Slot> d_slots;
+    std::vector<size_t> d_free;        // unused slot indices
+    std::list<size_t> d_recent;        // used slots, most recent first
+                                       // name -> slot
+    std::unordered_map<std::string, size_t, NameHash, std::equal_to<>> 
+                                                                    d_index;
+    uint64_t d_generation = 0;         // bumped by every invalidation
+    size_t d_hits = 0;
+    size_t d_misses = 0;
+
+    public:
+        struct Stats
+        {
+            size_t hits;
+            size_t misses;
+            size_t entries;
+        };
+
+        /** Cache of up to `capacity` secrets of at most `slotSize` bytes,
+         *  each valid for `ttl` after being inserted.
+         *  \throws std::bad_alloc if the secure region cannot be allocated.*/
+        SecretCache(size_t capacity, std::chrono::seconds ttl,
+                    size_t slotSize = 256);
+
+        SecretCache(SecretCache const &other) = delete;
+        SecretCache &operator=(SecretCache const &other) = delete;
+
+        ~SecretCache();
+
+        /** The unexpired secret cached under `name`, counting a hit or a
+         *  miss. */
+        std::optional<Secret> find(std::string_view name);
+
+        /** Current generation, to be passed to a later `insert`. */
+        uint64_t generation() const;
+
+        /** Cache `secret` under `name`, evicting the least recently used
+         *  entry if full, unless invalidated since `generation`. */
+        void insert(std::string_view name, std::string_view secret,
+                    uint64_t generation);
+
+        /** Drop the entry for `name`, if any. */
+        void erase(std::string_view name);
+
+        /** Drop every entry. */
+        void clear();
+
+        /** Hit and miss counts since construction, and the current number
+         *  of entries. */
+        Stats stats() const;
+
+    private:
+        /** Zeroize slot `idx` and return it to the free list; the caller
+         *  holds the mutex. */
+        void release(size_t idx);
+
+        /** Bytes of slot `idx`. */
+        unsigned char *slot(size_t idx) const;
+};
+
+#endif
@@ -0,0 +1,20 @@
+#include "secretCache.ih"
+
+SecretCache::SecretCache(size_t capacity, chrono::seconds ttl, 
+                         size_t slotSize)
+:
+    d_slotSize(slotSize),
+    d_ttl(ttl),                        // guarded, mlock'ed and 0xdb-filled
+    d_memory(static_cast<unsigned char *>(
+                    sodium_allocarray(max<size_t>(capacity, 1), slotSize))),
+    d_slots(max<size_t>(capacity, 1))
+{
+    if (d_memory == nullptr)
+        throw bad_alloc{};
+
+    d_free.reserve(d_slots.size());    // hand out low slots first
+    for (size_t idx = d_slots.size(); idx-- != 0; )
+        d_free.push_back(idx);
+
+    d_index.reserve(d_slots.size());
+}
@@ -0,0 +1,6 @@
+#include "secretCache.ih"
+
+unsigned char *SecretCache::slot(size_t idx) const
+{
+    return d_memory + idx * d_slotSize;
+}
@@ -0,0 +1,7 @@
+#include "secretCache.ih"
+
+SecretCache::Stats SecretCache::stats() const
+{
+    lock_guard lock(d_mutex);
+    return { d_hits, d_misses, d_index.size() };
+}
@@ -0,0 +1,9 @@
+template <typename Type>
+Type *SecureAllocator<Type>::allocate(size_t count)
+{
+    if (count > std::numeric_limits<size_t>::max() / sizeof(Type))
+        throw std::bad_array_new_length{};
+
+    return static_cast<Type *>(
+                    SecureArena::instance().allocate(count * sizeof(Type)));
+}
@@ -0,0 +1,5 @@
+template <typename Type>
+void SecureAllocator<Type>::deallocate(Type *ptr, size_t count) noexcept
+{
+    SecureArena::instance().deallocate(ptr, count * sizeof(Type));
+}
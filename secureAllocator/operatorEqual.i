@@ -0,0 +1,7 @@
+template <typename Type>
+template <typename Other>
+bool SecureAllocator<Type>::operator==(SecureAllocator<Other> const &) 
+                                                            const noexcept
+{
+    return true;
+}
@@ -0,0 +1,43 @@
+#ifndef INCLUDED_SECUREALLOCATOR_
+#define INCLUDED_SECUREALLOCATOR_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <vector>
+
+#include "../secureArena/secureArena.hh"
+
+/**
+ * \brief Standard allocator drawing from the `SecureArena`.
+ *
+ * Containers using it keep their elements in locked memory that is
+ * zeroized when released. `std::basic_string` keeps short contents inside
+ * the object itself, so secrets are held in vectors instead.
+ */
+template <typename Type>
+struct SecureAllocator
+{
+    using value_type = Type;
+
+    SecureAllocator() = default;
+
+    template <typename Other>
+    SecureAllocator(SecureAllocator<Other> const &) noexcept;
+
+    Type *allocate(size_t count);
+    void deallocate(Type *ptr, size_t count) noexcept;
+
+    template <typename Other>           // one arena: all are interchangeable
+    bool operator==(SecureAllocator<Other> const &) const noexcept;
+};
+                                       // byte buffer in the secure arena
+using SecureBytes = std::vector<std::uint8_t, SecureAllocator<std::uint8_t>>;
+
+#include "secureAllocator1.i"
+#include "allocate.i"
+#include "deallocate.i"
+#include "operatorEqual.i"
+
+#endif
@@ -0,0 +1,4 @@
+template <typename Type>
+template <typename Other>
+SecureAllocator<Type>::SecureAllocator(SecureAllocator<Other> const &) noexcept
+{}
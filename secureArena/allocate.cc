@@ -0,0 +1,49 @@
+#include "secureArena.ih"
+
+void *SecureArena::allocate(size_t bytes)
+{
+    size_t const idx = sizeClass(bytes);
+    if (idx == CLASSES)                // too large to pool
+    {
+        void *block = sodium_malloc(bytes);
+        if (block == nullptr)
+            throw bad_alloc{};
+        return block;
+    }
+
+    lock_guard lock(d_mutex);
+
+    if (void *block = d_free[idx])     // reuse a freed block: its first
+    {                                  // bytes link to the next one
+        d_free[idx] = *static_cast<void **>(block);
+        *static_cast<void **>(block) = nullptr;
+        return block;
+    }
+
+    size_t const size = size_t{ 1 } << (idx + MIN_SHIFT);
+    if (d_left < size)                 // a new chunk: the tail goes to the
+    {                                  // smaller classes' free lists
+        for (size_t cls = idx; cls-- != 0; )
+        {
+            size_t const piece = size_t{ 1 } << (cls + MIN_SHIFT);
+            if (d_left < piece)        // d_left < 2 * piece: at most one
+                continue;
+            *reinterpret_cast<void **>(d_cursor) = d_free[cls];
+            d_free[cls] = d_cursor;
+            d_cursor += piece;
+            d_left -= piece;
+        }
+
+        void *chunk = sodium_malloc(CHUNK_SIZE);
+        if (chunk == nullptr)
+            throw bad_alloc{};
+        d_chunks.push_back(chunk);
+        d_cursor = static_cast<unsigned char *>(chunk);
+        d_left = CHUNK_SIZE;
+    }
+
+    void *block = d_cursor;            // sizes are multiples of 16: every
+    d_cursor += size;                  // block stays 16-byte aligned
+    d_left -= size;
+    return block;
+}
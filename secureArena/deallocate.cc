@@ -0,0 +1,20 @@
+#include "secureArena.ih"
+
+void SecureArena::deallocate(void *ptr, size_t bytes) noexcept
+{
+    if (ptr == nullptr)
+        return;
+
+    size_t const idx = sizeClass(bytes);
+    if (idx == CLASSES)
+    {
+        sodium_free(ptr);              // zeroizes, unlocks, unmaps
+        return;
+    }
+
+    sodium_memzero(ptr, size_t{ 1 } << (idx + MIN_SHIFT));
+
+    lock_guard lock(d_mutex);
+    *static_cast<void **>(ptr) = d_free[idx];
+    d_free[idx] = ptr;
+}
@@ -0,0 +1,7 @@
+#include "secureArena.ih"
+
+SecureArena::~SecureArena()
+{                                      // sodium_free zeroizes each chunk
+    for (void *chunk: d_chunks)
+        sodium_free(chunk);
+}
@@ -0,0 +1,7 @@
+#include "secureArena.ih"
+                                       // static
+SecureArena &SecureArena::instance()
+{
+    static SecureArena arena;
+    return arena;
+}
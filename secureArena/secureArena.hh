@@ -0,0 +1,59 @@
+#ifndef INCLUDED_SECUREARENA_
+#define INCLUDED_SECUREARENA_
+
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+/**
+ * \brief Process-wide pool of locked, guard-paged memory for secrets.
+ *
+ * Memory is obtained from `sodium_malloc` in 64 KiB chunks (locked into RAM,
+ * framed by guard pages) and handed out in power-of-2 size classes from 16
+ * to 4096 bytes. Freed blocks are zeroized and kept on a per-class free 
+ * list, so after warming up an operation reuses the blocks of the previous
+ * one instead of allocating. Larger requests get their own `sodium_malloc`
+ * region. The guard pages frame a whole chunk, not its blocks, and the 
+ * tail of a chunk too short for a request is split into smaller blocks. 
+ * Chunks are only returned to the system at exit. Thread-safe.
+ */
+class SecureArena
+{
+    enum
+    {
+        MIN_SHIFT  = 4,                // smallest class: 16 bytes
+        CLASSES    = 9,                // ... largest: 4096 bytes
+        CHUNK_SIZE = 1 << 16
+    };
+
+    std::mutex d_mutex;
+    std::array<void *, CLASSES> d_free{};   // intrusive free lists
+    std::vector<void *> d_chunks;
+    unsigned char *d_cursor = nullptr; // unused tail of the last chunk
+    size_t d_left = 0;
+
+    public:
+        /** The arena shared by all secure allocations. */
+        static SecureArena &instance();
+
+        SecureArena(SecureArena const &other) = delete;
+        SecureArena &operator=(SecureArena const &other) = delete;
+
+        /** At least `bytes` bytes of locked memory, aligned for any type 
+         *  up to 16 bytes.
+         *  \throws std::bad_alloc if no memory is available.*/
+        void *allocate(size_t bytes);
+
+        /** Zeroize and take back `ptr`, obtained by `allocate(bytes)`. */
+        void deallocate(void *ptr, size_t bytes) noexcept;
+
+    private:
+        SecureArena() = default;
+        ~SecureArena();
+
+        /** Size class of `bytes`; CLASSES if it is too large for any. */
+        static size_t sizeClass(size_t bytes);
+};
+
+#endif
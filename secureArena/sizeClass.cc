@@ -0,0 +1,7 @@
+#include "secureArena.ih"
+                                       // static
+size_t SecureArena::sizeClass(size_t bytes)
+{
+    size_t const rounded = bit_ceil(max<size_t>(bytes, 1 << MIN_SHIFT));
+    return min<size_t>(countr_zero(rounded) - MIN_SHIFT, CLASSES);
+}
@@ -0,0 +1,30 @@
+#include "snapshotVault.ih"
+
+SnapshotVault::Header const *SnapshotVault::checked(Mapping const &file)
+{
+    auto const *header = static_cast<Header const *>(file.data);
+    auto const fits = [&](uint64_t offset, uint64_t bytes)
+    {
+        return offset <= file.size && bytes <= file.size - offset;
+    };
+
+    bool const valid = 
+        file.size >= PAGE_SIZE
+        && memcmp(header->magic, MAGIC, sizeof header->magic) == 0
+        && header->version == VERSION
+        && header->fileSize == file.size
+        && header->count <= file.size / sizeof(Slot)
+        && header->displacementOffset % PAGE_SIZE == 0
+        && header->slotOffset % PAGE_SIZE == 0
+        && fits(header->displacementOffset, 
+                PerfectHash::buckets(header->count) * sizeof(uint32_t))
+        && fits(header->slotOffset, header->count * sizeof(Slot))
+        && fits(header->recordOffset, 0);
+
+    if (!valid)
+    {
+        munmap(const_cast<void *>(file.data), file.size);
+        throw runtime_error("Not a valid cerberus snapshot");
+    }
+    return header;
+}
@@ -0,0 +1,6 @@
+#include "snapshotVault.ih"
+
+SnapshotVault::~SnapshotVault()
+{
+    munmap(const_cast<void *>(d_file.data), d_file.size);
+}
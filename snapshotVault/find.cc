@@ -0,0 +1,14 @@
+#include "snapshotVault.ih"
+
+optional<Secret> SnapshotVault::find(string_view website, 
+                                     string_view userIdentifier) const
+{
+    Slot const *slot = locate(website, userIdentifier);
+    if (!slot)
+        return nullopt;
+
+    Secret password(slot->size - crypto_aead_xchacha20poly1305_ietf_NPUBBYTES
+                    - crypto_aead_xchacha20poly1305_ietf_ABYTES);
+    open(*slot, { password.buffer(), password.size() });
+    return password;
+}
@@ -0,0 +1,11 @@
+#include "snapshotVault.ih"
+
+Secret SnapshotVault::get(string_view website, 
+                          string_view userIdentifier) const
+{
+    optional<Secret> password = find(website, userIdentifier);
+    if (!password)
+        throw runtime_error("No password stored for “" + string(website)
+                            + "” / user “" + string(userIdentifier) + "”.");
+    return move(*password);
+}
@@ -0,0 +1,11 @@
+#include "snapshotVault.ih"
+
+size_t SnapshotVault::get(string_view website, string_view userIdentifier,
+                          span<char> out) const
+{
+    Slot const *slot = locate(website, userIdentifier);
+    if (!slot)
+        throw runtime_error("No password stored for “" + string(website)
+                            + "” / user “" + string(userIdentifier) + "”.");
+    return open(*slot, out);
+}
@@ -0,0 +1,8 @@
+#include "snapshotVault.ih"
+
+PerfectHash::Hash SnapshotVault::hashOf(Locator const &locator)
+{                                      // a PRF output: already uniform
+    PerfectHash::Hash hash;
+    memcpy(hash.data(), locator.data(), sizeof hash);
+    return hash;
+}
@@ -0,0 +1,24 @@
+#include "snapshotVault.ih"
+
+SnapshotVault::Slot const *SnapshotVault::locate(string_view website,
+                                        string_view userIdentifier) const
+{
+    if (!d_key.valid())
+        throw runtime_error("The snapshot is locked. If you want to fetch a "
+                            "password, you have to unlock it first.");
+    if (d_header->count == 0)
+        return nullptr;
+
+    Locator const wanted = locator(d_locatorKey, website, userIdentifier);
+    Slot const &slot = d_slots[d_hash.slot(hashOf(wanted))];
+                                       // other names land on some slot too
+    if (sodium_memcmp(slot.locator.data(), wanted.data(), wanted.size()) != 0)
+        return nullptr;
+
+    if (slot.offset < d_header->recordOffset || slot.offset > d_file.size 
+        || slot.size > d_file.size - slot.offset 
+        || slot.size < crypto_aead_xchacha20poly1305_ietf_NPUBBYTES
+                       + crypto_aead_xchacha20poly1305_ietf_ABYTES)
+        throw runtime_error("Corrupt snapshot record");
+    return &slot;
+}
@@ -0,0 +1,26 @@
+#include "snapshotVault.ih"
+
+SnapshotVault::Locator SnapshotVault::locator(Key const &locatorKey,
+                                              string_view website,
+                                              string_view userIdentifier)
+{                                      // website \0 user, on the stack if
+    size_t const size = website.size() + 1 + userIdentifier.size(); // short
+    array<unsigned char, NAMES_INLINE> onStack;
+    string onHeap;
+    unsigned char *names = onStack.data();
+    if (size > onStack.size())
+    {
+        onHeap.resize(size);
+        names = reinterpret_cast<unsigned char *>(onHeap.data());
+    }
+
+    auto next = ranges::copy(website, names).out;
+    *next++ = '\0';
+    ranges::copy(userIdentifier, next);
+
+    Locator result;                    // a 128-bit PRF of the names
+    crypto_shorthash_siphashx24(result.data(), names, size, 
+                                locatorKey.data());
+    sodium_memzero(names, size);
+    return result;
+}
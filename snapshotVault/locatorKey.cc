@@ -0,0 +1,10 @@
+#include "snapshotVault.ih"
+
+Key SnapshotVault::locatorKey(Key const &key)
+{
+    Key sub;
+    crypto_kdf_derive_from_key(sub.data(), sub.size(), 1, 
+                               SnapshotFormat::CONTEXT, key.data());
+    sub.setValid(true);
+    return sub;
+}
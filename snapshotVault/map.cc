@@ -0,0 +1,26 @@
+#include "snapshotVault.ih"
+
+SnapshotVault::Mapping SnapshotVault::map(string const &filename)
+{
+    int const fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        throw runtime_error("Cannot open " + filename + ": " 
+                            + strerror(errno));
+
+    struct stat status;
+    if (fstat(fd, &status) != 0 || status.st_size == 0)
+    {
+        ::close(fd);
+        throw runtime_error(filename + " is not a snapshot");
+    }
+
+    size_t const size = status.st_size;
+    void *data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);                       // the mapping keeps the file
+    if (data == MAP_FAILED)
+        throw runtime_error("Cannot map " + filename + ": " 
+                            + strerror(errno));
+                                       // lookups touch scattered pages
+    madvise(data, size, MADV_RANDOM);
+    return { data, size };
+}
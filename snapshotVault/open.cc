@@ -0,0 +1,24 @@
+#include "snapshotVault.ih"
+
+size_t SnapshotVault::open(Slot const &slot, span<char> out) const
+{
+    size_t const nonceSize = crypto_aead_xchacha20poly1305_ietf_NPUBBYTES;
+    size_t const size = slot.size - nonceSize  // `locate` checked its size
+                        - crypto_aead_xchacha20poly1305_ietf_ABYTES;
+    if (out.size() < size)
+        throw runtime_error("The password needs " + to_string(size) 
+                            + " bytes.");
+                                       // from the mapped record into `out`
+    auto const *record = static_cast<unsigned char const *>(d_file.data) 
+                         + slot.offset;
+    if (crypto_aead_xchacha20poly1305_ietf_decrypt_detached(
+            reinterpret_cast<unsigned char *>(out.data()), /*nsec=*/nullptr,
+            record + nonceSize, size, record + nonceSize + size,
+            slot.locator.data(), slot.locator.size(),
+            record, d_key.data()) != 0)
+    {
+        sodium_memzero(out.data(), size);
+        throw runtime_error("Decryption failed (tampering or wrong key)");
+    }
+    return size;
+}
@@ -0,0 +1,19 @@
+#include "snapshotVault.ih"
+
+SecureBytes SnapshotVault::seal(Key const &key, Locator const &locator,
+                                string_view password)
+{
+    size_t const nonceSize = crypto_aead_xchacha20poly1305_ietf_NPUBBYTES;
+    SecureBytes sealed(nonceSize + password.size() 
+                       + crypto_aead_xchacha20poly1305_ietf_ABYTES);
+    randombytes_buf(sealed.data(), nonceSize);
+
+    crypto_aead_xchacha20poly1305_ietf_encrypt_detached(
+        sealed.data() + nonceSize,     // cipher, followed by the tag
+        sealed.data() + nonceSize + password.size(), nullptr,
+        reinterpret_cast<unsigned char const *>(password.data()), 
+        password.size(),
+        locator.data(), locator.size(),
+        /*nsec=*/nullptr, sealed.data(), key.data());
+    return sealed;
+}
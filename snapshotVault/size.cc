@@ -0,0 +1,6 @@
+#include "snapshotVault.ih"
+
+size_t SnapshotVault::size() const
+{
+    return d_header->count;
+}
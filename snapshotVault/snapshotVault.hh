@@ -0,0 +1,185 @@
+#ifndef INCLUDED_SNAPSHOTVAULT_
+#define INCLUDED_SNAPSHOTVAULT_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <sodium.h>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "../key/key.hh"
+#include "../perfectHash/perfectHash.hh"
+#include "../secret/secret.hh"
+#include "../secureAllocator/secureAllocator.hh"
+
+/**
+ * \brief Read-only vault in an immutable, memory-mapped snapshot file.
+ *
+ * Written by `Vault::exportSnapshot`, for consumers that only `get`. The
+ * file holds, each part starting on a page boundary:
+ *
+ *  - a `Header`: the format, the counts and offsets of the parts, and the
+ *    snapshot's own random key wrapped by the vault's KEK (the Argon2id key
+ *    of the master password, with the salt and cost stored next to it);
+ *
+ *  - the displacements of a `PerfectHash` over the entries' locators (the
+ *    128-bit SipHash of `website + '\0' + userIdentifier`, keyed with a
+ *    subkey of the snapshot key; the names themselves are not stored);
+ *
+ *  - one 32-byte `Slot` per entry, in perfect-hash order: its locator and
+ *    where its record is;
+ *
+ *  - the records: nonce || ciphertext || tag, sealed under the snapshot
+ *    key with the locator as additional data, which binds a record to its
+ *    names as the names themselves would.
+ *
+ * Opening maps the file and checks the header, nothing more. A lookup
+ * computes the locator, reads one displacement and one slot, and decrypts
+ * the record where it is mapped; nothing is allocated. The file is 
+ * little-endian.
+ */
+class SnapshotVault
+{
+    public:
+        enum
+        {
+            PAGE_SIZE    = 4096,       // alignment of the parts
+            LOCATOR_SIZE = crypto_shorthash_siphashx24_BYTES,
+            NAMES_INLINE = 256,        // longer names are joined on the heap
+            WRAPPED_SIZE = crypto_aead_xchacha20poly1305_ietf_NPUBBYTES
+                           + crypto_aead_xchacha20poly1305_ietf_KEYBYTES
+                           + crypto_aead_xchacha20poly1305_ietf_ABYTES,
+            VERSION      = 1
+        };
+                                       // identifies the format
+        static constexpr char MAGIC[9] = "CERBSNAP";
+
+        using Locator = std::array<std::uint8_t, LOCATOR_SIZE>;
+
+        struct Header                  // the first page of the file
+        {
+            char          magic[8];
+            std::uint64_t version;
+            std::uint64_t count;       // entries
+            std::uint64_t seed;        // of the perfect hash
+            std::uint64_t displacementOffset;
+            std::uint64_t slotOffset;
+            std::uint64_t recordOffset;
+            std::uint64_t fileSize;
+            std::uint64_t opsLimit;    // Argon2 cost of the KEK
+            std::uint64_t memLimit;
+            std::uint8_t  salt[crypto_pwhash_SALTBYTES];
+            std::uint8_t  wrappedKey[WRAPPED_SIZE];
+        };
+
+        struct Slot
+        {
+            Locator       locator;
+            std::uint64_t offset;      // of the record, from the file start
+            std::uint32_t size;        // of the record
+            std::uint32_t reserved;
+        };
+
+    private:
+        struct Mapping
+        {
+            void const *data;
+            std::size_t size;
+        };
+
+        Mapping d_file;                // the whole file, read-only
+        Header const *d_header;
+        Slot const *d_slots;
+        PerfectHash d_hash;
+        Key d_key;                     // the snapshot key, once unlocked
+        Key d_locatorKey;
+
+    public:
+        /**
+         * Map the snapshot `filename` and validate its header.
+         * \throws std::runtime_error if it cannot be mapped or is not a
+         *         valid snapshot.
+         */
+        explicit SnapshotVault(std::string const &filename);
+
+        SnapshotVault(SnapshotVault const &other) = delete;
+        SnapshotVault &operator=(SnapshotVault const &other) = delete;
+
+        ~SnapshotVault();
+
+        /** Number of entries. */
+        std::size_t size() const;
+
+        /** Derive the KEK of `master` (wiped) and unwrap the snapshot key;
+         *  false if it is the wrong password. */
+        bool unlock(std::string &master);
+
+        /**
+         * The password of (website, userIdentifier), nullopt if there is
+         * none.
+         * \throws std::runtime_error if locked or the record fails to 
+         *         authenticate.
+         */
+        std::optional<Secret> find(std::string_view website, 
+                                   std::string_view userIdentifier) const;
+
+        /** As `find`, but \throws std::runtime_error if there is no entry.*/
+        Secret get(std::string_view website, 
+                   std::string_view userIdentifier) const;
+
+        /**
+         * Decrypt the password of (website, userIdentifier) from the mapped
+         * record straight into `out`.
+         * \returns its length.
+         * \throws std::runtime_error as `get`, or if `out` is too small.
+         */
+        std::size_t get(std::string_view website, 
+                        std::string_view userIdentifier,
+                        std::span<char> out) const;
+
+        /** The locator key of the snapshot key `key` (SipHash uses its 
+         *  first crypto_shorthash_siphashx24_KEYBYTES bytes). */
+        static Key locatorKey(Key const &key);
+
+        /** The locator of (website, userIdentifier) under `locatorKey`. */
+        static Locator locator(Key const &locatorKey, 
+                               std::string_view website, 
+                               std::string_view userIdentifier);
+
+        /** The perfect-hash key of `locator`. */
+        static PerfectHash::Hash hashOf(Locator const &locator);
+
+        /** `password` sealed under `key` for the entry at `locator`:
+         *  nonce || ciphertext || tag. */
+        static SecureBytes seal(Key const &key, Locator const &locator,
+                                std::string_view password);
+
+        /** `key` sealed under `kek`, as stored in the header. */
+        static void wrap(Key const &key, Key const &kek, 
+                         std::uint8_t (&wrapped)[WRAPPED_SIZE]);
+
+    private:
+        /** The slot of (website, userIdentifier); nullptr if there is no
+         *  entry. \throws std::runtime_error if locked.*/
+        Slot const *locate(std::string_view website, 
+                           std::string_view userIdentifier) const;
+
+        /** Decrypt the record of `slot` into `out`; returns the plaintext
+         *  size. \throws std::runtime_error if `out` is too small or the
+         *  record fails to authenticate.*/
+        std::size_t open(Slot const &slot, std::span<char> out) const;
+
+        /** Map `filename` read-only.
+         *  \throws std::runtime_error on failure.*/
+        static Mapping map(std::string const &filename);
+
+        /** The mapped header, after checking it against the file size; on
+         *  failure `file` is unmapped.
+         *  \throws std::runtime_error if it is not a valid snapshot.*/
+        static Header const *checked(Mapping const &file);
+};
+
+#endif
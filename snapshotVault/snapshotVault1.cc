@@ -0,0 +1,15 @@
+#include "snapshotVault.ih"
+
+SnapshotVault::SnapshotVault(string const &filename)
+:
+    d_file(map(filename)),
+    d_header(checked(d_file)),
+    d_slots(reinterpret_cast<Slot const *>(
+                static_cast<char const *>(d_file.data) 
+                + d_header->slotOffset)),
+    d_hash(d_header->seed, d_header->count,
+           { reinterpret_cast<uint32_t const *>(
+                static_cast<char const *>(d_file.data) 
+                + d_header->displacementOffset),
+             PerfectHash::buckets(d_header->count) })
+{}
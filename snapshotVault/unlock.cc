@@ -0,0 +1,26 @@
+#include "snapshotVault.ih"
+
+bool SnapshotVault::unlock(string &master)
+{
+    KdfParams params;
+    params.opsLimit = d_header->opsLimit;
+    params.memLimit = d_header->memLimit;
+    params.validate();                 // bounds a forged header's cost
+
+    Key kek;
+    params.derive({ kek.data(), kek.size() }, master, d_header->salt);
+    sodium_memzero(master.data(), master.size());
+
+    size_t const nonceSize = crypto_aead_xchacha20poly1305_ietf_NPUBBYTES;
+    if (crypto_aead_xchacha20poly1305_ietf_decrypt(
+            d_key.data(), nullptr, /*nsec=*/nullptr,
+            d_header->wrappedKey + nonceSize, WRAPPED_SIZE - nonceSize,
+            reinterpret_cast<unsigned char const *>(SnapshotFormat::WRAP_AD),
+            sizeof SnapshotFormat::WRAP_AD - 1,
+            d_header->wrappedKey, kek.data()) != 0)
+        return false;                  // another password
+
+    d_key.setValid(true);
+    d_locatorKey = locatorKey(d_key);
+    return true;
+}
@@ -0,0 +1,14 @@
+#include "snapshotVault.ih"
+
+void SnapshotVault::wrap(Key const &key, Key const &kek, 
+                         uint8_t (&wrapped)[WRAPPED_SIZE])
+{                                      // nonce || cipher || tag
+    size_t const nonceSize = crypto_aead_xchacha20poly1305_ietf_NPUBBYTES;
+    randombytes_buf(wrapped, nonceSize);
+
+    crypto_aead_xchacha20poly1305_ietf_encrypt(
+        wrapped + nonceSize, nullptr, key.data(), key.size(),
+        reinterpret_cast<unsigned char const *>(SnapshotFormat::WRAP_AD),
+        sizeof SnapshotFormat::WRAP_AD - 1,
+        /*nsec=*/nullptr, wrapped, kek.data());
+}
@@ -0,0 +1,6 @@
+#include "spaceStats.ih"
+
+double SpaceStats::bytesPerEntry() const
+{
+    return static_cast<double>(fileSize()) / max(entries, 1LL);
+}
@@ -0,0 +1,6 @@
+#include "spaceStats.ih"
+
+long long SpaceStats::fileSize() const
+{
+    return pages * pageSize;
+}
@@ -0,0 +1,14 @@
+#include "spaceStats.ih"
+
+ostream &operator<<(ostream &out, SpaceStats const &stats)
+{
+    double const freeShare = stats.pages == 0 ? 0 
+                                : 100.0 * stats.freePages / stats.pages;
+
+    return out << "pages=" << stats.pages 
+               << " free=" << stats.freePages 
+               << " (" << static_cast<int>(freeShare + .5) << "%)"
+               << " file=" << stats.fileSize() << " bytes, "
+               << static_cast<long long>(stats.bytesPerEntry() + .5) 
+               << " bytes/entry";
+}
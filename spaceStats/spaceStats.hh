@@ -0,0 +1,30 @@
+#ifndef INCLUDED_SPACESTATS_
+#define INCLUDED_SPACESTATS_
+
+#include <cstddef>
+#include <iosfwd>
+
+/**
+ * \brief Space use of a vault file.
+ *
+ * `pages` includes the `freePages` that SQLite keeps for reuse; those only
+ * return to the file system when the vault is compacted.
+ */
+struct SpaceStats
+{
+    long long pageSize  = 0;           // bytes
+    long long pages     = 0;           // in the file
+    long long freePages = 0;           // unused pages in the file
+    long long entries   = 0;           // rows in the Vault table
+
+    /** Size of the database file in bytes. */
+    long long fileSize() const;
+
+    /** File bytes per stored entry (the whole file when it is empty). */
+    double bytesPerEntry() const;
+};
+
+/** Print as `pages=... free=... (x%) file=... bytes, ... bytes/entry`. */
+std::ostream &operator<<(std::ostream &out, SpaceStats const &stats);
+
+#endif
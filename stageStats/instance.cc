@@ -0,0 +1,7 @@
+#include "stageStats.ih"
+
+StageStats &StageStats::instance()
+{
+    static StageStats stats;
+    return stats;
+}
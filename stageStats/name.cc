@@ -0,0 +1,10 @@
+#include "stageStats.ih"
+
+char const *StageStats::name(Stage stage)
+{
+    static char const *const names[STAGES] = 
+    { 
+        "prepare", "step", "decrypt", "encrypt", "derive", "get", "add"
+    };
+    return names[stage];
+}
@@ -0,0 +1,20 @@
+#include "stageStats.ih"
+
+ostream &operator<<(ostream &out, StageStats const &stats)
+{
+    out << left << setw(9) << "stage" << right << setw(10) << "count" 
+        << setw(12) << "mean us" << setw(12) << "p50 us" 
+        << setw(12) << "p99 us" << setw(12) << "max us" << '\n'
+        << fixed << setprecision(1);
+
+    for (size_t stage = 0; stage != StageStats::STAGES; ++stage)
+    {
+        auto const id = static_cast<StageStats::Stage>(stage);
+        StageStats::Summary const summary = stats.summary(id);
+        out << left << setw(9) << StageStats::name(id) 
+            << right << setw(10) << summary.count 
+            << setw(12) << summary.mean << setw(12) << summary.p50 
+            << setw(12) << summary.p99 << setw(12) << summary.max << '\n';
+    }
+    return out;
+}
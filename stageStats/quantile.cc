@@ -0,0 +1,22 @@
+#include "stageStats.ih"
+
+#include <cmath>
+
+double StageStats::quantile(Histogram const &histogram, double fraction)
+{
+    uint64_t total = 0;
+    for (auto const &bucket: histogram.buckets)
+        total += bucket.load(memory_order_relaxed);
+    if (total == 0)
+        return 0;
+
+    uint64_t const rank = max<uint64_t>(ceil(fraction * total), 1);
+    uint64_t seen = 0;
+    for (size_t bucket = 0; bucket != BUCKETS; ++bucket)
+    {
+        seen += histogram.buckets[bucket].load(memory_order_relaxed);
+        if (seen >= rank)              // bucket b holds values below 2^b
+            return ldexp(1.0, bucket);
+    }
+    return ldexp(1.0, BUCKETS);
+}
@@ -0,0 +1,18 @@
+#include "stageStats.ih"
+
+void StageStats::record(Stage stage, chrono::nanoseconds elapsed)
+{
+    uint64_t const ns = max<int64_t>(elapsed.count(), 0);
+    Histogram &histogram = d_histograms[stage];
+                                       // counters only: ordering does not
+    histogram.count.fetch_add(1, memory_order_relaxed);         // matter
+    histogram.sum.fetch_add(ns, memory_order_relaxed);
+    histogram.buckets[min<size_t>(bit_width(ns), BUCKETS - 1)]
+             .fetch_add(1, memory_order_relaxed);
+
+    uint64_t seen = histogram.max.load(memory_order_relaxed);
+    while (ns > seen 
+           && not histogram.max.compare_exchange_weak(seen, ns, 
+                                                      memory_order_relaxed))
+        ;
+}
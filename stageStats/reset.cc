@@ -0,0 +1,13 @@
+#include "stageStats.ih"
+
+void StageStats::reset()
+{
+    for (Histogram &histogram: d_histograms)
+    {
+        histogram.count.store(0, memory_order_relaxed);
+        histogram.sum.store(0, memory_order_relaxed);
+        histogram.max.store(0, memory_order_relaxed);
+        for (auto &bucket: histogram.buckets)
+            bucket.store(0, memory_order_relaxed);
+    }
+}
@@ -0,0 +1,109 @@
+#ifndef INCLUDED_STAGESTATS_
+#define INCLUDED_STAGESTATS_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+
+/**
+ * \brief Process-wide latency histograms of the vault's hot-path stages.
+ *
+ * Always on: recording a duration costs a few relaxed atomic increments,
+ * so the stages of a slow `get` (statement lookup, `sqlite3_step`, AEAD,
+ * Argon2) can be told apart on a production host without a profiler. Each
+ * stage has a histogram of 64 power-of-2 buckets of nanoseconds plus the
+ * exact count, sum and maximum; percentiles are reported as the upper
+ * bound of the bucket they fall in, so they are accurate within a factor
+ * of 2. Thread-safe.
+ */
+class StageStats
+{
+    public:
+        enum Stage
+        {
+            PREPARE,                   // DbHandle::prepare (cache or compile)
+            STEP,                      // sqlite3_step of a lookup or store
+            DECRYPT,                   // AEAD open of one entry
+            ENCRYPT,                   // AEAD seal of one entry
+            DERIVE,                    // Argon2 key derivation
+            GET,                       // whole Vault::get
+            ADD,                       // whole Vault::add
+            STAGES
+        };
+
+        enum
+        {
+            BUCKETS = 64               // bucket b: [2^(b-1), 2^b) ns
+        };
+
+        struct Summary                 // in microseconds
+        {
+            uint64_t count;
+            double mean;
+            double p50;
+            double p99;
+            double max;
+        };
+
+        /** Records the lifetime of the object as a duration of `stage`. */
+        class Timer
+        {
+            Stage d_stage;
+            std::chrono::steady_clock::time_point d_start;
+
+            public:
+                explicit Timer(Stage stage);
+                Timer(Timer const &other) = delete;
+                Timer &operator=(Timer const &other) = delete;
+                ~Timer();
+        };
+
+        /** The statistics shared by all vaults. */
+        static StageStats &instance();
+
+        StageStats(StageStats const &other) = delete;
+        StageStats &operator=(StageStats const &other) = delete;
+
+        /** Run `function` and record its duration as `stage`. */
+        template <typename Function>
+        static auto time(Stage stage, Function &&function);
+
+        void record(Stage stage, std::chrono::nanoseconds elapsed);
+
+        Summary summary(Stage stage) const;
+
+        /** Lower-case name of `stage`, as used in reports. */
+        static char const *name(Stage stage);
+
+        /** Every stage's summary and non-empty buckets as one JSON object. */
+        void writeJson(std::ostream &out) const;
+
+        /** Forget everything recorded so far. */
+        void reset();
+
+    private:
+        struct Histogram
+        {
+            std::atomic<uint64_t> count{ 0 };
+            std::atomic<uint64_t> sum{ 0 };        // ns
+            std::atomic<uint64_t> max{ 0 };        // ns
+            std::array<std::atomic<uint64_t>, BUCKETS> buckets{};
+        };
+
+        std::array<Histogram, STAGES> d_histograms;
+
+        StageStats() = default;
+
+        /** Upper bound (in ns) of the bucket holding the `fraction` 
+         *  quantile of `histogram`.*/
+        static double quantile(Histogram const &histogram, double fraction);
+};
+
+/** One line per stage: count, mean, p50, p99 and max in microseconds. */
+std::ostream &operator<<(std::ostream &out, StageStats const &stats);
+
+#include "time.i"
+
+#endif
@@ -0,0 +1,18 @@
+#include "stageStats.ih"
+
+StageStats::Summary StageStats::summary(Stage stage) const
+{
+    Histogram const &histogram = d_histograms[stage];
+    uint64_t const count = histogram.count.load(memory_order_relaxed);
+    double const sum = histogram.sum.load(memory_order_relaxed);
+    double const max = histogram.max.load(memory_order_relaxed);
+                                       // a bucket's bound may exceed the
+    return                             // largest value seen
+    { 
+        count, 
+        count == 0 ? 0 : sum / count / 1000,
+        min(quantile(histogram, .50), max) / 1000,
+        min(quantile(histogram, .99), max) / 1000,
+        max / 1000
+    };
+}
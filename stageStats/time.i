@@ -0,0 +1,6 @@
+template <typename Function>
+auto StageStats::time(Stage stage, Function &&function)
+{
+    Timer const timer(stage);
+    return function();
+}
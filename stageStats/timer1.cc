@@ -0,0 +1,7 @@
+#include "stageStats.ih"
+
+StageStats::Timer::Timer(Stage stage)
+:
+    d_stage(stage),
+    d_start(chrono::steady_clock::now())
+{}
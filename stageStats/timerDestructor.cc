@@ -0,0 +1,6 @@
+#include "stageStats.ih"
+
+StageStats::Timer::~Timer()
+{
+    instance().record(d_stage, chrono::steady_clock::now() - d_start);
+}
@@ -0,0 +1,32 @@
+#include "stageStats.ih"
+
+void StageStats::writeJson(ostream &out) const
+{
+    out << fixed << setprecision(3) << "{";
+
+    for (size_t stage = 0; stage != STAGES; ++stage)
+    {
+        Summary const stats = summary(static_cast<Stage>(stage));
+        out << (stage == 0 ? "\n" : ",\n") 
+            << "  \"" << name(static_cast<Stage>(stage)) << "\": { "
+               "\"count\": " << stats.count 
+            << ", \"mean_us\": " << stats.mean
+            << ", \"p50_us\": " << stats.p50 
+            << ", \"p99_us\": " << stats.p99
+            << ", \"max_us\": " << stats.max 
+            << ", \"buckets_ns\": {";
+                                       // upper bound -> count, non-empty only
+        char const *separator = " ";
+        Histogram const &histogram = d_histograms[stage];
+        for (size_t bucket = 0; bucket != BUCKETS; ++bucket)
+            if (uint64_t const count = 
+                        histogram.buckets[bucket].load(memory_order_relaxed))
+            {
+                out << separator << "\"" << (uint64_t{ 1 } << bucket) 
+                    << "\": " << count;
+                separator = ", ";
+            }
+        out << " } }";
+    }
+    out << "\n}\n";
+}
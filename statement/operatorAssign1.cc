@@ -6,8 +6,9 @@ Statement &Statement::operator=(Statement &&tmp)
     {
         reset();
         ptr = tmp.ptr;
+        d_borrowed = tmp.d_borrowed;
         tmp.ptr = nullptr;
     }
 
     return *this;
-}
\ No newline at end of file
+}
@@ -2,9 +2,16 @@
 
 void Statement::reset()
 {
-    if (ptr) 
-    {
-        sqlite3_finalize(ptr); 
-        ptr = nullptr;
+    if (!ptr) 
+        return;
+
+    if (d_borrowed)                    // the cache keeps it: only rewind it 
+    {                                  // and drop the bound values
+        sqlite3_reset(ptr);
+        sqlite3_clear_bindings(ptr);
     }
-}
\ No newline at end of file
+    else
+        sqlite3_finalize(ptr); 
+
+    ptr = nullptr;
+}
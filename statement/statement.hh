@@ -9,12 +9,19 @@
  * Finalizes the statement in the destructor or on move-assignment of a new
  * handle. Copy is disabled because two owners finalizing the same statement
  * would be undefined behavior.
+ *
+ * A statement handed out by `DbHandle::prepare` is *borrowed* from the
+ * connection's statement cache: instead of finalizing it, the destructor
+ * resets it and clears its bindings so the next user gets a clean statement.
  */
 struct Statement
 {
     sqlite3_stmt *ptr = nullptr;
 
     Statement() = default;
+    /** Borrow a cached statement; it is reset, not finalized, on release. */
+    explicit Statement(sqlite3_stmt *cached);
+
     Statement(Statement const &other) = delete;
     Statement(Statement &&tmp);
 
@@ -24,8 +31,10 @@ struct Statement
     ~Statement();
 
     private:
-        /** Finalize and reset `ptr` to nullptr. */
+        bool d_borrowed = false;       // owned by a DbHandle's cache
+
+        /** Finalize (or, if borrowed, reset) and set `ptr` to nullptr. */
         void reset();
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -2,7 +2,8 @@
 
 Statement::Statement(Statement &&tmp)
 :
-    ptr(tmp.ptr)
+    ptr(tmp.ptr),
+    d_borrowed(tmp.d_borrowed)
 {
     tmp.ptr = nullptr;
-}
\ No newline at end of file
+}
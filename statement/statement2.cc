@@ -0,0 +1,7 @@
+#include "statement.ih"
+
+Statement::Statement(sqlite3_stmt *cached)
+:
+    ptr(cached),
+    d_borrowed(true)
+{}
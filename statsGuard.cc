@@ -0,0 +1,13 @@
+#include "main.ih"
+
+StatsGuard::~StatsGuard()
+{
+    try
+    {
+        dumpStats();
+    }
+    catch (exception const &ex)        // not out of a destructor
+    {
+        cerr << "Cannot write the statistics: " << ex.what() << '\n';
+    }
+}
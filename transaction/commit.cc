@@ -0,0 +1,9 @@
+#include "transaction.ih"
+
+void Transaction::commit()
+{
+    if (sqlite3_exec(d_db, "COMMIT;", nullptr, nullptr, nullptr) != SQLITE_OK)
+        throw runtime_error("SQLite commit failed: " 
+                            + string(sqlite3_errmsg(d_db)));
+    d_open = false;
+}
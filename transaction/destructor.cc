@@ -0,0 +1,7 @@
+#include "transaction.ih"
+
+Transaction::~Transaction()
+{
+    if (d_open)
+        sqlite3_exec(d_db, "ROLLBACK;", nullptr, nullptr, nullptr);
+}
@@ -0,0 +1,31 @@
+#ifndef INCLUDED_TRANSACTION_
+#define INCLUDED_TRANSACTION_
+
+#include <sqlite3.h>
+
+/**
+ * \brief RAII guard for an SQLite write transaction.
+ *
+ * Begins an immediate transaction in the constructor. Unless `commit` has
+ * been called, the destructor rolls the transaction back, so an exception
+ * thrown halfway through a batch leaves the database untouched.
+ */
+class Transaction
+{
+    sqlite3 *d_db;
+    bool d_open = true;                // neither committed nor rolled back
+
+    public:
+        explicit Transaction(sqlite3 *db);
+
+        Transaction(Transaction const &other) = delete;
+        Transaction &operator=(Transaction const &other) = delete;
+
+        ~Transaction();
+
+        /** Commit the transaction.
+         *  \throws std::runtime_error if SQLite refuses to commit.*/
+        void commit();
+};
+
+#endif
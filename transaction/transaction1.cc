@@ -0,0 +1,12 @@
+#include "transaction.ih"
+
+Transaction::Transaction(sqlite3 *db)
+:
+    d_db(db)
+{                                      // take the write lock up front rather 
+                                       // than on the first INSERT
+    if (sqlite3_exec(d_db, "BEGIN IMMEDIATE;", nullptr, nullptr, nullptr) 
+            != SQLITE_OK)
+        throw runtime_error("SQLite begin failed: " 
+                            + string(sqlite3_errmsg(d_db)));
+}
@@ -0,0 +1,48 @@
+#include "trigramIndex.ih"
+
+vector<uint32_t> TrigramIndex::candidates(Grams const &grams) const
+{
+    if (grams.empty())                 // short fragment: every entry
+    {
+        vector<uint32_t> ids(d_entries.size());
+        for (uint32_t id = 0; id != ids.size(); ++id)
+            ids[id] = id;
+        return ids;
+    }
+
+    vector<vector<uint32_t> const *> lists;
+    for (uint32_t gram: grams)
+    {
+        auto const found = d_postings.find(gram);
+        if (found == d_postings.end())
+            return {};                 // no name holds this trigram
+        lists.push_back(&found->second);
+    }
+                                       // shortest first: the running
+    ranges::sort(lists, {}, [](auto list)   // intersection only shrinks
+    {
+        return list->size();
+    });
+
+    vector<uint32_t> ids = *lists.front();
+    vector<uint32_t> next;
+    for (auto list: span(lists).subspan(1))
+    {
+        if (ids.empty())
+            break;
+                                       // a common trigram's list is much
+        if (list->size() > SEARCH_RATIO * ids.size())  // longer: probe it
+        {
+            erase_if(ids, [&](uint32_t id)
+            {
+                return not ranges::binary_search(*list, id);
+            });
+            continue;
+        }
+
+        next.clear();
+        ranges::set_intersection(ids, *list, back_inserter(next));
+        ids.swap(next);
+    }
+    return ids;
+}
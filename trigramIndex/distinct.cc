@@ -0,0 +1,13 @@
+#include "trigramIndex.ih"
+
+TrigramIndex::Grams TrigramIndex::distinct(
+                                    initializer_list<string_view> names)
+{
+    Grams grams;
+    for (string_view name: names)      // not across the names
+        trigrams(grams, name);
+
+    ranges::sort(grams);
+    grams.erase(ranges::unique(grams).begin(), grams.end());
+    return grams;
+}
@@ -0,0 +1,6 @@
+#include "trigramIndex.ih"
+
+char TrigramIndex::fold(char ch)
+{                                      // no locale: UTF-8 bytes unchanged
+    return 'A' <= ch && ch <= 'Z' ? ch - 'A' + 'a' : ch;
+}
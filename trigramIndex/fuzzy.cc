@@ -0,0 +1,27 @@
+#include "trigramIndex.ih"
+
+void TrigramIndex::fuzzy(vector<Scored> &scored, Grams const &grams,
+                         vector<uint32_t> const &found) const
+{
+    vector<uint16_t> shared(d_entries.size());
+    vector<uint32_t> touched;
+    for (uint32_t gram: grams)         // count the fragment's trigrams
+    {                                  // per entry
+        auto const postings = d_postings.find(gram);
+        if (postings != d_postings.end())
+            for (uint32_t id: postings->second)
+                if (shared[id]++ == 0)
+                    touched.push_back(id);
+    }
+
+    double const total = grams.size();
+    for (uint32_t id: touched)
+    {
+        if (3 * shared[id] < grams.size() || ranges::binary_search(found, id))
+            continue;
+                                       // share of the fragment, then 
+        double const hits = shared[id];// Jaccard: fewer other trigrams
+        double const jaccard = hits / (total + d_entries[id].trigrams - hits);
+        scored.emplace_back(0.5 * hits / total + 0.49 * jaccard, id);
+    }
+}
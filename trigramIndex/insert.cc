@@ -0,0 +1,25 @@
+#include "trigramIndex.ih"
+
+bool TrigramIndex::insert(string_view website, string_view userIdentifier)
+{
+    Names names;
+    names.reserve(website.size() + 1 + userIdentifier.size());
+    names.insert(names.end(), website.begin(), website.end());
+    names.push_back('\0');
+    names.insert(names.end(), userIdentifier.begin(), 
+                 userIdentifier.end());
+
+    if (d_ids.contains(string_view(names.data(), names.size())))
+        return false;
+
+    Grams const grams = distinct({ website, userIdentifier });
+    uint32_t const id = d_entries.size();
+
+    d_entries.push_back({ move(names), static_cast<uint32_t>(website.size()),
+                          static_cast<uint32_t>(grams.size()) });
+    d_ids.emplace(view(d_entries.back()), id);
+
+    for (uint32_t gram: grams)         // ids grow: the lists stay sorted
+        d_postings[gram].push_back(id);
+    return true;
+}
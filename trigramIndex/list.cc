@@ -0,0 +1,20 @@
+#include "trigramIndex.ih"
+
+vector<pair<string, string>> TrigramIndex::list() const
+{
+    vector<uint32_t> ids(d_entries.size());
+    for (uint32_t id = 0; id != ids.size(); ++id)
+        ids[id] = id;
+                                       // '\0' sorts before any byte: by
+    ranges::sort(ids, {}, [&](uint32_t id) -> string_view   // website,
+    {                                                        // then user
+        return view(d_entries[id]);
+    });
+
+    vector<pair<string, string>> names;
+    names.reserve(ids.size());
+    for (uint32_t id: ids)
+        names.emplace_back(website(d_entries[id]), 
+                           userIdentifier(d_entries[id]));
+    return names;
+}
@@ -0,0 +1,42 @@
+#include "trigramIndex.ih"
+
+vector<TrigramIndex::Match> TrigramIndex::search(string_view fragment, 
+                                                 size_t limit) const
+{
+    string query(fragment);
+    ranges::transform(query, query.begin(), fold);
+    if (query.empty())
+        return {};
+
+    Grams const grams = distinct({ query });
+
+    vector<Scored> scored;
+    vector<uint32_t> found;            // ascending ids of substring matches
+    for (uint32_t id: candidates(grams))
+        if (double const score = substring(d_entries[id], query); score > 0)
+        {
+            scored.emplace_back(score, id);
+            found.push_back(id);
+        }
+
+    if (not grams.empty() && (limit == 0 || scored.size() < limit))
+        fuzzy(scored, grams, found);
+
+    if (limit == 0 || limit > scored.size())
+        limit = scored.size();
+                                       // only the best `limit` are ordered
+    auto const better = [&](Scored const &lhs, Scored const &rhs)
+    {
+        if (lhs.first != rhs.first)
+            return lhs.first > rhs.first;
+        return view(d_entries[lhs.second]) < view(d_entries[rhs.second]);
+    };
+    ranges::partial_sort(scored, scored.begin() + limit, better);
+
+    vector<Match> matches;
+    matches.reserve(limit);
+    for (auto const &[score, id]: span(scored).first(limit))
+        matches.push_back({ string(website(d_entries[id])), 
+                            string(userIdentifier(d_entries[id])), score });
+    return matches;
+}
@@ -0,0 +1,6 @@
+#include "trigramIndex.ih"
+
+size_t TrigramIndex::size() const
+{
+    return d_entries.size();
+}
@@ -0,0 +1,28 @@
+#include "trigramIndex.ih"
+
+namespace
+{
+    bool boundary(char ch)
+    {
+        return ch == '.' || ch == '@' || ch == '-' || ch == '_';
+    }
+}
+
+double TrigramIndex::substring(Entry const &entry, string_view query) const
+{
+    double best = 0;
+    for (string_view name: { website(entry), userIdentifier(entry) })
+    {
+        auto const found = ranges::search(name, query, {}, fold);
+        if (found.empty())
+            continue;
+
+        size_t const at = found.begin() - name.begin();
+        double const score = 
+            name.size() == query.size() ? 2                     // whole
+            : 1 + (at == 0 || boundary(name[at - 1]) ? 0.5 : 0) // start
+                + 0.49 * query.size() / name.size();            // cover
+        best = max(best, score);
+    }
+    return best;
+}
@@ -0,0 +1,120 @@
+#ifndef INCLUDED_TRIGRAMINDEX_
+#define INCLUDED_TRIGRAMINDEX_
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../secureAllocator/secureAllocator.hh"
+
+/**
+ * \brief In-memory trigram index over (website, user) name pairs.
+ *
+ * Every name is case-folded (ASCII) and split into its distinct 3-byte
+ * trigrams; each trigram keeps the ascending ids of the entries having it.
+ * A fragment of 3 or more bytes can only occur in a name holding all its
+ * trigrams, so substring candidates are the intersection of a few posting
+ * lists, checked against the names. Shorter fragments scan the names.
+ * When there are fewer substring matches than asked for, entries sharing
+ * at least a third of the fragment's trigrams are added as fuzzy matches
+ * (typos, swapped or missing characters), ranked below every substring
+ * match.
+ *
+ * Entries are only ever added; adding a pair that is present is a no-op.
+ * As the names may be secret (a blinded vault), they and the trigrams 
+ * are kept in the `SecureArena`, which zeroizes memory when it is 
+ * released; posting lists only hold entry ids. The index is not 
+ * thread-safe: its owner serializes access.
+ */
+class TrigramIndex
+{
+    using Names = std::vector<char, SecureAllocator<char>>;
+    using Grams = std::vector<std::uint32_t, SecureAllocator<std::uint32_t>>;
+    using Postings = std::unordered_map<std::uint32_t, 
+                        std::vector<std::uint32_t>, std::hash<std::uint32_t>,
+                        std::equal_to<std::uint32_t>, 
+                        SecureAllocator<std::pair<std::uint32_t const, 
+                                            std::vector<std::uint32_t>>>>;
+
+    struct Entry
+    {
+        Names names;                   // website + '\0' + userIdentifier
+        std::uint32_t split;           // length of the website
+        std::uint32_t trigrams;        // distinct trigrams of both names
+    };
+                                       // `d_ids` views the names
+    std::deque<Entry> d_entries;       // id -> entry
+    std::unordered_map<std::string_view, std::uint32_t> d_ids;
+                                       // trigram -> ascending entry ids
+    Postings d_postings;
+
+    public:
+        enum
+        {                              // posting lists this many times 
+            SEARCH_RATIO = 16          // longer than the candidates are
+        };                             // binary-searched, not merged
+
+        struct Match
+        {
+            std::string website;
+            std::string userIdentifier;
+            double score;              // [1, 2]: substring (2: a whole 
+        };                             // name), below 1: fuzzy
+
+        /** Add the pair (website, userIdentifier); false if present.*/
+        bool insert(std::string_view website, 
+                    std::string_view userIdentifier);
+
+        /** Number of entries.*/
+        std::size_t size() const;
+
+        /** Every (website, userIdentifier) pair, sorted.*/
+        std::vector<std::pair<std::string, std::string>> list() const;
+
+        /**
+         * The at most `limit` (0: all) entries best matching `fragment`,
+         * case-insensitively, best first: whole names, then names 
+         * starting with it (or with it after a `.`, `@`, `-` or `_`), 
+         * then names containing it, shorter names first; then fuzzy
+         * matches by the share of the fragment's trigrams they hold.
+         */
+        std::vector<Match> search(std::string_view fragment, 
+                                  std::size_t limit = 20) const;
+
+    private:
+        using Scored = std::pair<double, std::uint32_t>;  // score, id
+
+        /** ASCII lower case of `ch`.*/
+        static char fold(char ch);
+
+        /** Appends the trigrams of `name` to `grams`.*/
+        static void trigrams(Grams &grams, std::string_view name);
+
+        /** The distinct trigrams of the folded `names`, sorted.*/
+        static Grams distinct(std::initializer_list<std::string_view> names);
+
+        /** The names of `entry`: both, website and user.*/
+        static std::string_view view(Entry const &entry);
+        static std::string_view website(Entry const &entry);
+        static std::string_view userIdentifier(Entry const &entry);
+
+        /** Ids of the entries holding all `grams` (all ids if empty).*/
+        std::vector<std::uint32_t> candidates(Grams const &grams) const;
+
+        /** Substring score of the folded `query` in `entry`, 0 if it 
+         *  occurs in neither name.*/
+        double substring(Entry const &entry, std::string_view query) const;
+
+        /** Appends the fuzzy matches of `grams` that are not in the 
+         *  ascending `found`.*/
+        void fuzzy(std::vector<Scored> &scored, Grams const &grams,
+                   std::vector<std::uint32_t> const &found) const;
+};
+
+#endif
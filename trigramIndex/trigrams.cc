@@ -0,0 +1,12 @@
+#include "trigramIndex.ih"
+
+void TrigramIndex::trigrams(Grams &grams, string_view name)
+{
+    for (size_t idx = 0; idx + 3 <= name.size(); ++idx)
+        grams.push_back(
+            static_cast<uint32_t>(
+                static_cast<unsigned char>(fold(name[idx]))) << 16 
+            | static_cast<uint32_t>(
+                static_cast<unsigned char>(fold(name[idx + 1]))) << 8
+            | static_cast<unsigned char>(fold(name[idx + 2])));
+}
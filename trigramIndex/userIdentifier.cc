@@ -0,0 +1,6 @@
+#include "trigramIndex.ih"
+
+string_view TrigramIndex::userIdentifier(Entry const &entry)
+{
+    return view(entry).substr(entry.split + 1);
+}
@@ -0,0 +1,6 @@
+#include "trigramIndex.ih"
+
+string_view TrigramIndex::view(Entry const &entry)
+{
+    return { entry.names.data(), entry.names.size() };
+}
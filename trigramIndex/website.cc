@@ -0,0 +1,6 @@
+#include "trigramIndex.ih"
+
+string_view TrigramIndex::website(Entry const &entry)
+{
+    return view(entry).substr(0, entry.split);
+}
@@ -0,0 +1,17 @@
+#include "main.ih"
+                                       // one password for vaults that share
+void unlockVaults(MultiVault &vaults)  // it, then one per remaining vault
+{
+    string master = IOTools::hiddenPrompt("Master password: ");
+    vaults.unlock(master);
+    for (size_t idx = 0; idx != vaults.size(); ++idx)
+    {
+        if (vaults.unlocked(idx))
+            continue;
+        master = IOTools::hiddenPrompt("Master password for " 
+                                       + vaults.name(idx) + ": ");
+        if (!vaults.unlock(idx, master))
+            cerr << "Incorrect password: skipping " << vaults.name(idx) 
+                 << ".\n";
+    }
+}
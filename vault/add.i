@@ -0,0 +1,13 @@
+template <typename Policy>
+Secret Vault::add(std::string const &website, 
+                  std::string const &userIdentifier)
+{
+    return insert(website, userIdentifier, []
+                  {
+                      Secret password = Policy::generate();
+                      if (not Policy::satisfies(password.data()))
+                          throw std::logic_error("A generated password "
+                                                 "violates its policy");
+                      return password;
+                  });
+}
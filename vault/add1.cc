@@ -0,0 +1,11 @@
+#include "vault.ih"
+
+Secret Vault::add(string const &website, string const &userIdentifier,
+                  PasswordGenerator::Policy const &policy)
+{
+    PasswordGenerator generator;
+    return insert(website, userIdentifier, [&]
+                  {
+                      return generator.generate(policy);
+                  });
+}
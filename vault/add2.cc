@@ -0,0 +1,12 @@
+#include "vault.ih"
+
+Secret Vault::add(string const &website, string const &userIdentifier,
+                  size_t length)
+{
+    if (length < 4)
+        throw invalid_argument("Password length must be at least 4");
+
+    PasswordGenerator::Policy policy;  // every class, at least once
+    policy.length = length;
+    return add(website, userIdentifier, policy);
+}
@@ -0,0 +1,35 @@
+#include "vault.ih"
+
+size_t Vault::addMany(vector<Credential> const &credentials, size_t chunkSize)
+{
+    if (!d_key.valid())
+        throw runtime_error("The vault is locked. If you want to add entries, "
+                            "you have to unlock it first.");
+
+    lock_guard lock(d_writeMutex);
+
+    if (chunkSize == 0)                // 0: everything in one transaction
+        chunkSize = credentials.size();
+
+    size_t stored = 0;
+    while (stored != credentials.size())
+    {
+        size_t const begin = stored;
+        size_t const end = min(credentials.size(), stored + chunkSize);
+
+        Transaction transaction(d_db); // one journal sync per chunk instead 
+        for (; stored != end; ++stored)// of one per row
+        {
+            Credential const &credential = credentials[stored];
+            store(d_key, credential.website, credential.userIdentifier,
+                  credential.password.data());
+        }
+        transaction.commit();
+
+        for (size_t idx = begin; idx != end; ++idx)
+            committed(credentials[idx].website, 
+                      credentials[idx].userIdentifier);
+    }
+
+    return stored;
+}
@@ -0,0 +1,39 @@
+#include "vault.ih"
+
+size_t Vault::addMany(function<optional<Credential>()> const &next, 
+                      size_t chunkSize)
+{
+    if (!d_key.valid())
+        throw runtime_error("The vault is locked. If you want to add entries, "
+                            "you have to unlock it first.");
+
+    lock_guard lock(d_writeMutex);
+
+    size_t stored = 0;
+    for (bool more = true; more; )
+    {                                  // the chunk's names, for the index
+        vector<pair<string, string>> names;   // and cache once committed
+
+        Transaction transaction(d_db);
+        while (chunkSize == 0 || names.size() != chunkSize)
+        {
+            optional<Credential> credential = next();
+            if (!credential)
+            {
+                more = false;
+                break;
+            }
+            store(d_key, credential->website, credential->userIdentifier,
+                  credential->password.data());
+            names.emplace_back(move(credential->website), 
+                               move(credential->userIdentifier));
+        }                              // the password is wiped here
+        transaction.commit();
+
+        stored += names.size();
+        for (auto const &[website, userIdentifier]: names)
+            committed(website, userIdentifier);
+    }
+
+    return stored;
+}
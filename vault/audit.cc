@@ -0,0 +1,17 @@
+#include "vault.ih"
+
+vector<pair<string, string>> Vault::audit() const
+{
+    shared_ptr<BreachIndex const> const breaches = this->breaches();
+    if (!breaches)
+        throw runtime_error("No breach corpus is set.");
+
+    vector<pair<string, string>> breached;
+    forEach([&](Credential const &credential)
+    {
+        if (breaches->contains(credential.password.data()))
+            breached.emplace_back(credential.website, 
+                                  credential.userIdentifier);
+    });
+    return breached;
+}
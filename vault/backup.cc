@@ -0,0 +1,93 @@
+#include "vault.ih"
+
+namespace
+{
+    enum
+    {
+        BUSY_SLEEP_MS = 10             // when another connection writes
+    };
+
+    size_t copyPages(DbHandle const &source, string const &scratch,
+                     mutex &writer, size_t pagesPerStep,
+                     function<void(size_t, size_t)> const &progress)
+    {
+        DbHandle const target(scratch);
+        sqlite3_backup *copy = sqlite3_backup_init(target, "main", 
+                                                   source, "main");
+        if (copy == nullptr)
+            throw runtime_error("Cannot start the backup: " 
+                                + string(sqlite3_errmsg(target)));
+
+        int result;
+        do
+        {
+            {                          // add waits for one step at most
+                lock_guard lock(writer);
+                result = sqlite3_backup_step(copy, pagesPerStep);
+            }
+            if (result == SQLITE_BUSY || result == SQLITE_LOCKED)
+                sqlite3_sleep(BUSY_SLEEP_MS);
+            else if (progress && result == SQLITE_OK)
+                progress(sqlite3_backup_pagecount(copy) 
+                                        - sqlite3_backup_remaining(copy), 
+                         sqlite3_backup_pagecount(copy));
+        }
+        while (result == SQLITE_OK || result == SQLITE_BUSY 
+               || result == SQLITE_LOCKED);
+
+        size_t const pages = sqlite3_backup_pagecount(copy);
+        sqlite3_backup_finish(copy);
+        if (result != SQLITE_DONE)
+            throw runtime_error("Backup failed: " 
+                                + string(sqlite3_errstr(result)));
+
+        if (progress)
+            progress(pages, pages);
+        return pages;
+    }
+}
+
+size_t Vault::backup(string const &archive, string &password, 
+                     size_t pagesPerStep, 
+                     function<void(size_t, size_t)> const &progress)
+{
+    if (pagesPerStep == 0)
+        throw invalid_argument("A backup step must copy at least one page");
+
+    string const scratch = archive + ".part";
+    bool archiveCreated = false;
+    bool scratchCreated = false;
+    try
+    {                                  // never truncate an existing file
+        createPrivate(archive);        // (e.g. the vault itself)
+        archiveCreated = true;
+        createPrivate(scratch);
+        scratchCreated = true;
+
+        size_t const pages = copyPages(d_db, scratch, d_writeMutex, 
+                                       pagesPerStep, progress);
+
+        ifstream in(scratch, ios::binary);
+        ofstream out(archive, ios::binary);
+        if (!out)
+            throw runtime_error("Cannot write " + archive);
+
+        Archive::seal(in, out, password, d_kdf);
+        sodium_memzero(password.data(), password.size());
+        if (!out.flush())
+            throw runtime_error("Writing " + archive + " failed");
+
+        filesystem::remove(scratch);
+        return pages;
+    }
+    catch (...)
+    {
+        sodium_memzero(password.data(), password.size());
+        error_code ignored;            // only the files created here
+        if (scratchCreated)
+            filesystem::remove(scratch, ignored);
+        if (archiveCreated)
+            filesystem::remove(archive, ignored);
+        throw;
+    }
+}
@@ -0,0 +1,14 @@
+#include "vault.ih"
+
+void Vault::bindName(sqlite3_stmt *statement, int idx, 
+                     SecureBytes const &value, 
+                     sqlite3_destructor_type lifetime) const
+{                                      // locators and sealed names are 
+    if (d_blinded)                     // binary
+        sqlite3_bind_blob(statement, idx, value.data(), value.size(),
+                          lifetime);
+    else
+        sqlite3_bind_text(statement, idx, 
+                          reinterpret_cast<char const *>(value.data()), 
+                          value.size(), lifetime);
+}
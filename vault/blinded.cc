@@ -0,0 +1,6 @@
+#include "vault.ih"
+
+bool Vault::blinded() const
+{
+    return d_blinded;
+}
@@ -0,0 +1,12 @@
+#include "vault.ih"
+
+shared_ptr<BreachIndex const> Vault::breaches() const
+{
+    lock_guard lock(d_breachMutex);
+    if (d_openBreaches)                // first use: open it now
+    {
+        d_breaches = d_openBreaches();
+        d_openBreaches = nullptr;
+    }
+    return d_breaches;
+}
@@ -0,0 +1,6 @@
+#include "vault.ih"
+
+SecretCache::Stats Vault::cacheStats() const
+{
+    return d_cache ? d_cache->stats() : SecretCache::Stats{ 0, 0, 0 };
+}
@@ -0,0 +1,21 @@
+#include "vault.ih"
+
+size_t Vault::changeKdf(string &master, KdfParams const &params)
+{
+    if (!d_key.valid())
+        throw runtime_error("The vault is locked. If you want to change its "
+                            "KDF parameters, you have to unlock it first.");
+    params.validate();
+    checkMaster(master);
+                                       // new salt, new cost: new KEK
+    vector<uint8_t> salt(crypto_pwhash_SALTBYTES);
+    randombytes_buf(salt.data(), salt.size());
+    Key const kek = deriveKek(master, salt, params);
+    sodium_memzero(master.data(), master.size());
+                                       // only the wrapped data key changes;
+    size_t const count =               // older vaults get one first
+        installKey(readMeta("dek") ? nullopt : optional(randomKey()), 
+                   kek, salt, params);
+    d_kdf = params;
+    return count;
+}
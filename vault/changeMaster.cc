@@ -0,0 +1,43 @@
+#include "vault.ih"
+
+size_t Vault::changeMaster(string &current, string &next)
+{
+    if (!d_key.valid())
+        throw runtime_error("The vault is locked. If you want to change its "
+                            "master password, you have to unlock it first.");
+
+    if (optional<Key> const kek = recoveryKek(current))
+    {                                  // a recovery key must unwrap the 
+        optional<string> const wrapped = readMeta("dek_recovery");
+        optional<Key> const key = wrapped ? unwrapKey(*wrapped, *kek) 
+                                          : nullopt;
+        sodium_memzero(current.data(), current.size());
+        if (!key || sodium_memcmp(key->data(), d_key.data(), 
+                                  d_key.size()) != 0)
+        {
+            sodium_memzero(next.data(), next.size());
+            throw runtime_error("Incorrect recovery key.");
+        }
+    }
+    else
+    {
+        try
+        {
+            checkMaster(current);
+        }
+        catch (...)
+        {
+            sodium_memzero(next.data(), next.size());
+            throw;
+        }
+        sodium_memzero(current.data(), current.size());
+    }
+                                       // new salt: a new KEK wraps the 
+    vector<uint8_t> salt(crypto_pwhash_SALTBYTES);      // same data key
+    randombytes_buf(salt.data(), salt.size());
+    Key const kek = deriveKek(next, salt, d_kdf);
+    sodium_memzero(next.data(), next.size());
+
+    return installKey(readMeta("dek") ? nullopt : optional(randomKey()), 
+                      kek, salt, d_kdf);
+}
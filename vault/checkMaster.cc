@@ -0,0 +1,23 @@
+#include "vault.ih"
+
+Key Vault::checkMaster(string &master)
+{
+    Key kek = deriveKek(master, loadOrCreateSalt(), d_kdf);
+                                       // the password must reproduce the
+    bool matches;                      // session key
+    if (optional<string> const wrapped = readMeta("dek"))
+    {
+        optional<Key> const key = unwrapKey(*wrapped, kek);
+        matches = key && sodium_memcmp(key->data(), d_key.data(), 
+                                       d_key.size()) == 0;
+    }
+    else                               // older vault: the KEK is the key
+        matches = sodium_memcmp(kek.data(), d_key.data(), d_key.size()) == 0;
+
+    if (!matches)
+    {
+        sodium_memzero(master.data(), master.size());
+        throw runtime_error("Incorrect master password.");
+    }
+    return kek;
+}
@@ -0,0 +1,8 @@
+#include "vault.ih"
+                                       // static
+span<uint8_t const> Vault::columnBlob(Statement const &row, int col)
+{                                      // valid until the row changes
+    auto ptr = static_cast<uint8_t const *>(sqlite3_column_blob(row.ptr, col));
+    size_t size = sqlite3_column_bytes(row.ptr, col);
+    return { ptr, size };
+}
@@ -0,0 +1,31 @@
+#include "vault.ih"
+
+pair<SecureBytes, SecureBytes> Vault::columnNames(Key const &key, 
+                                        string const &website,
+                                        string const &userIdentifier) const
+{
+    if (!d_blinded)
+        return { SecureBytes(website.begin(), website.end()), 
+                 SecureBytes(userIdentifier.begin(), userIdentifier.end()) };
+
+    SecureBytes const names = joinNames(website, userIdentifier);
+                                       // keyed BLAKE2b: equal names give
+    SecureBytes locator(LOCATOR_SIZE); // equal, indexable column values
+    {
+        Key const locatorKey = subkey(key, LOCATOR_KEY);
+        crypto_generichash(locator.data(), locator.size(), 
+                           names.data(), names.size(),
+                           locatorKey.data(), locatorKey.size());
+    }
+                                       // sealed deterministically: the nonce
+    SecureBytes sealed(names.size()    // is the locator, a PRF of the names
+                       + crypto_aead_xchacha20poly1305_ietf_ABYTES);
+    {
+        Key const namesKey = subkey(key, NAMES_KEY);
+        crypto_aead_xchacha20poly1305_ietf_encrypt(
+            sealed.data(), nullptr, names.data(), names.size(),
+            nullptr, 0, nullptr, locator.data(), namesKey.data());
+    }
+
+    return { move(locator), move(sealed) };
+}
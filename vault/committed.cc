@@ -0,0 +1,13 @@
+#include "vault.ih"
+
+void Vault::committed(string const &website, string const &userIdentifier)
+{
+    indexNames(website, userIdentifier);
+                                       // once committed, readers can no
+    if (d_cache)                       // longer re-cache the old secret
+    {
+        SecureBytes const names = joinNames(website, userIdentifier);
+        d_cache->erase({ reinterpret_cast<char const *>(names.data()), 
+                         names.size() });
+    }
+}
@@ -0,0 +1,15 @@
+#include "vault.ih"
+
+SpaceStats Vault::compact()
+{                                      // return the free pages to the 
+    if (queryNumber("PRAGMA auto_vacuum;") == 2)   // file system
+        d_db.exec("PRAGMA incremental_vacuum;");
+    else
+        d_db.exec("VACUUM;");
+                                       // and truncate a WAL file that a 
+    if (d_durability.journalMode == "WAL")         // busy period grew
+        d_db.exec("PRAGMA wal_checkpoint(TRUNCATE);");
+
+    d_db.exec("PRAGMA optimize;");     // refresh the planner's statistics
+    return spaceStats();
+}
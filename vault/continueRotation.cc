@@ -0,0 +1,158 @@
+#include "vault.ih"
+
+namespace
+{
+    struct Rotated                     // one entry on its way through the
+    {                                  // pipeline
+        SecureBytes website;           // name columns as read, then as
+        SecureBytes userIdentifier;    // stored under the new key
+        vector<uint8_t> nonce;
+        vector<uint8_t> tag;
+        vector<uint8_t> cipher;
+        SecureBytes oldWebsite;        // the row's key under the old key
+        SecureBytes oldUserIdentifier;
+        SecureBytes sealed;            // v2 blob under the new key
+    };
+
+    SecureBytes bytes(sqlite3_stmt *statement, int col)
+    {
+        auto const *ptr = static_cast<uint8_t const *>(
+                                        sqlite3_column_blob(statement, col));
+        return SecureBytes(ptr, ptr + sqlite3_column_bytes(statement, col));
+    }
+
+    void load(Rotated &row, sqlite3_stmt *statement)
+    {
+        row.website = bytes(statement, 0);
+        row.userIdentifier = bytes(statement, 1);
+        for (auto [col, out]: { pair{ 2, &row.nonce }, pair{ 3, &row.tag },
+                                pair{ 4, &row.cipher } })
+        {
+            auto const *ptr = static_cast<uint8_t const *>(
+                                        sqlite3_column_blob(statement, col));
+            out->assign(ptr, ptr + sqlite3_column_bytes(statement, col));
+        }
+    }
+
+    string text(SecureBytes const &bytes)
+    {
+        return string(bytes.begin(), bytes.end());
+    }
+}
+
+size_t Vault::continueRotation(size_t batchSize, size_t threads,
+                               function<void(size_t, size_t)> const &progress)
+{
+    optional<Key> pending = unwrapKey(*readMeta("rotate_key"), d_key);
+    if (!pending)
+        throw runtime_error("The key of the pending rotation does not "
+                            "authenticate");
+    Key next = move(*pending);
+    size_t done = stoul(readMeta("rotate_done").value_or("0"));
+    size_t const total = done + queryNumber("SELECT count(*) "
+                                            "FROM RotationQueue;");
+    char constexpr batchSql[] =        // reader: the next batch of entries
+        "SELECT   q.Website, q.UserIdentifier, v.nonce, v.tag, v.ciphertext "
+        "FROM     RotationQueue AS q "
+        "JOIN     Vault AS v "
+        "ON       v.Website = q.Website "
+        "     AND v.UserIdentifier = q.UserIdentifier "
+        "ORDER BY q.Website, q.UserIdentifier "
+        "LIMIT    ?1;";
+    char constexpr dropEntrySql[] = 
+        "DELETE FROM Vault WHERE Website=?1 AND UserIdentifier=?2;";
+    char constexpr dequeueSql[] = 
+        "DELETE FROM RotationQueue WHERE Website=?1 AND UserIdentifier=?2;";
+
+    auto const remove = [&](char const *sql, Rotated const &row)
+    {
+        Statement statement = d_db.prepare(sql);
+        bindName(statement.ptr, 1, row.oldWebsite);
+        bindName(statement.ptr, 2, row.oldUserIdentifier);
+        if (sqlite3_step(statement.ptr) != SQLITE_DONE)
+            throw runtime_error("SQLite delete failed: " 
+                                + string(sqlite3_errmsg(d_db)));
+    };
+
+    WorkerPool pool(threads);
+    vector<Rotated> batch(max<size_t>(batchSize, 1));
+    for (;;)
+    {
+        size_t filled = 0;
+        {
+            Statement statement = d_db.prepare(batchSql);
+            sqlite3_bind_int64(statement.ptr, 1, batch.size());
+            int result;
+            while ((result = sqlite3_step(statement.ptr)) == SQLITE_ROW)
+                load(batch[filled++], statement.ptr);
+            if (result != SQLITE_DONE)
+                throw runtime_error("SQLite step failed: " 
+                                    + string(sqlite3_errmsg(d_db)));
+        }                              // reset: the writer may go ahead
+        if (filled == 0)
+            break;
+                                       // workers: old key out, new key in
+        pool.run(filled, [&](size_t idx)
+            {
+                Rotated &row = batch[idx];
+                string website = text(row.website);
+                string userIdentifier = text(row.userIdentifier);
+                if (d_blinded)
+                    tie(website, userIdentifier) = 
+                                openNames(d_key, website, userIdentifier);
+
+                Secret const password = decrypt(d_key, website, 
+                                                userIdentifier, row.nonce,
+                                                row.tag, row.cipher);
+                row.sealed = seal(next, website, userIdentifier, 
+                                  password.data());
+                row.oldWebsite = move(row.website);
+                row.oldUserIdentifier = move(row.userIdentifier);
+                tie(row.website, row.userIdentifier) = 
+                                columnNames(next, website, userIdentifier);
+            }
+        );
+                                       // writer: the batch and the progress
+        Transaction transaction(d_db); // made, atomically
+        for (Rotated const &row: span(batch).first(filled))
+        {
+            if (d_blinded)             // a new key moves a blinded row
+                remove(dropEntrySql, row);
+            remove(dequeueSql, row);
+            upsert(row.website, row.userIdentifier, row.sealed);
+        }
+        done += filled;
+        writeMeta("rotate_done", to_string(done));
+        transaction.commit();
+
+        if (progress)
+            progress(done, total);
+    }
+
+    Transaction transaction(d_db);     // switch over to the new key
+    if (optional<string> const dek = readMeta("rotate_dek"))
+        writeMeta("dek", *dek);
+    if (optional<string> const salt = readMeta("rotate_salt"))
+        writeMeta("salt", *salt);      // planned as a new derived key
+    d_meta.reset();
+    d_db.exec("DELETE FROM meta WHERE key IN "
+              "   ('rotate_dek', 'rotate_salt', 'rotate_key', 'rotate_done',"
+              "    'dek_recovery');"
+              "DROP TABLE RotationQueue;");
+
+    Key previous = move(d_key);
+    d_key = move(next);
+    try
+    {
+        storeKeyCheck();
+        transaction.commit();
+    }
+    catch (...)                        // rolled back: keep the old key
+    {
+        d_key = move(previous);
+        throw;
+    }
+
+    publishKey();
+    return done;
+}
@@ -0,0 +1,11 @@
+#include "vault.ih"
+
+void Vault::createPrivate(string const &filename)
+{                                      // O_EXCL: never reuse a file someone
+    int const fd = ::open(filename.c_str(),   // else may have opened
+                          O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+    if (fd < 0)
+        throw runtime_error("Cannot create " + filename + ": " 
+                            + strerror(errno));
+    ::close(fd);
+}
@@ -0,0 +1,36 @@
+#include "vault.ih"
+
+Secret Vault::createRecoveryKey(string &master)
+{
+    if (!d_key.valid())
+        throw runtime_error("The vault is locked. If you want to create a "
+                            "recovery key, you have to unlock it first.");
+
+    Key const kek = checkMaster(master);
+    sodium_memzero(master.data(), master.size());
+    if (!readMeta("dek"))              // older vault: a data key first
+        installKey(randomKey(), kek, loadOrCreateSalt(), d_kdf);
+
+    SecureBytes raw(RECOVERY_SIZE);
+    randombytes_buf(raw.data(), raw.size());
+                                       // prefix, then hex in groups of 8
+    size_t const prefix = sizeof RECOVERY_PREFIX - 1;
+    Secret text(prefix + 2 * raw.size() + raw.size() / 4 - 1);
+    char *out = text.buffer();
+    memcpy(out, RECOVERY_PREFIX, prefix);
+    out += prefix;
+    for (size_t idx = 0; idx != raw.size(); ++idx)
+    {
+        if (idx != 0 && idx % 4 == 0)
+            *out++ = '-';
+        char hex[3];
+        sodium_bin2hex(hex, sizeof hex, &raw[idx], 1);
+        *out++ = hex[0];
+        *out++ = hex[1];
+        sodium_memzero(hex, sizeof hex);
+    }
+
+    optional<Key> const recovery = recoveryKek(text.data());
+    writeMeta("dek_recovery", wrapKey(d_key, *recovery));
+    return text;
+}
@@ -0,0 +1,14 @@
+#include "vault.ih"
+
+Secret Vault::decrypt(Key const &key, 
+                      string const &website, string const &userIdentifier,
+                      span<uint8_t const> nonce, span<uint8_t const> tag,
+                      span<uint8_t const> cipher) const
+{
+    unpack(nonce, tag, cipher);        // the plaintext is as long as the
+                                       // ciphertext proper
+    Secret plain(cipher.size());
+    decrypt(key, website, userIdentifier, nonce, tag, cipher, 
+            { plain.buffer(), plain.size() });
+    return plain;
+}
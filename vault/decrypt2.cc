@@ -0,0 +1,37 @@
+#include "vault.ih"
+
+size_t Vault::decrypt(Key const &key, 
+                      string const &website, string const &userIdentifier,
+                      span<uint8_t const> nonce, span<uint8_t const> tag,
+                      span<uint8_t const> cipher, span<char> out) const
+{
+    unpack(nonce, tag, cipher);
+
+    if (nonce.size() != crypto_aead_xchacha20poly1305_ietf_NPUBBYTES
+        || tag.size() != crypto_aead_xchacha20poly1305_ietf_ABYTES)
+        throw runtime_error("Corrupt entry for “" + website 
+                               + "” / user “" + userIdentifier + "”.");
+
+    if (out.size() < cipher.size())
+        throw runtime_error("The password of “" + website + "” / user “" 
+                            + userIdentifier + "” needs " 
+                            + to_string(cipher.size()) + " bytes.");
+                                       // detached form: decrypt straight
+                                       // from the column memory into `out`
+    SecureBytes const ad = joinNames(website, userIdentifier);
+    StageStats::Timer const timer(StageStats::DECRYPT);
+    if (crypto_aead_xchacha20poly1305_ietf_decrypt_detached(
+            reinterpret_cast<unsigned char *>(out.data()),
+            /*nsec=*/nullptr,
+            cipher.data(), cipher.size(),
+            tag.data(),
+            ad.data(), ad.size(),
+            nonce.data(),
+            key.data()) != 0)
+    {
+        sodium_memzero(out.data(), cipher.size());
+        throw runtime_error("Decryption failed (tampering or wrong key)");
+    }
+
+    return cipher.size();
+}
@@ -0,0 +1,13 @@
+#include "vault.ih"
+
+Key Vault::deriveKek(string const &master, span<uint8_t const> salt,
+                     KdfParams const &params)
+{
+    Key kek;
+    StageStats::time(StageStats::DERIVE, [&]
+    {
+        params.derive({ kek.data(), kek.size() }, master, salt);
+    });
+    kek.setValid(true);
+    return kek;
+}
@@ -0,0 +1,38 @@
+#include "vault.ih"
+
+namespace
+{
+    auto constexpr PROGRESS_INTERVAL = 100ms;
+}
+
+Key Vault::deriveOverlapped(string const &master, 
+                            function<void()> const &waiting)
+{                                      // the connection stays on this 
+    vector<uint8_t> const salt = loadOrCreateSalt();   // thread; the 
+                                       // worker only runs Argon2
+    future<Key> kek = async(launch::async, [&]
+    {
+        return deriveKek(master, salt, d_kdf);
+    });
+
+    auto next = chrono::steady_clock::now() + PROGRESS_INTERVAL;
+    auto const ready = [&]
+    {
+        if (kek.wait_for(0s) == future_status::ready)
+            return true;
+        if (waiting && chrono::steady_clock::now() >= next)
+        {
+            waiting();
+            next += PROGRESS_INTERVAL;
+        }
+        return false;
+    };
+                                       // cold pages are read while Argon2
+    warmUp(ready);                     // keeps another core busy
+    
+    while (kek.wait_for(PROGRESS_INTERVAL) != future_status::ready)
+        if (waiting)
+            waiting();
+
+    return kek.get();
+}
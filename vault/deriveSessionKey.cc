@@ -4,16 +4,13 @@ void Vault::deriveSessionKey(string &master)
 {                                      // fetch or create a random salt 
                                        // (16 bytes) stored in meta table
     vector<uint8_t> salt = loadOrCreateSalt();
-                                       
                                        // derive a 32-byte key with argon2-id
-    if (crypto_pwhash(d_key.data(), d_key.size(),
-                      master.data(), master.size(),
-                      salt.data(),
-                      crypto_pwhash_OPSLIMIT_MODERATE,
-                      crypto_pwhash_MEMLIMIT_MODERATE,
-                      crypto_pwhash_ALG_DEFAULT) != 0)
-        throw runtime_error("Key derivation failed");
+                                       // at the vault's own cost
+    StageStats::time(StageStats::DERIVE, [&]
+    {
+        d_kdf.derive({ d_key.data(), d_key.size() }, master, salt);
+    });
     
     d_key.setValid(true);              // mark vault unlocked 
     sodium_memzero(master.data(), master.size());
-}
\ No newline at end of file
+}
@@ -0,0 +1,6 @@
+#include "vault.ih"
+
+Durability const &Vault::durability() const
+{
+    return d_durability;
+}
@@ -0,0 +1,6 @@
+#include "vault.ih"
+
+void Vault::enableCache(size_t capacity, chrono::seconds ttl)
+{
+    d_cache = make_unique<SecretCache>(capacity, ttl);
+}
@@ -0,0 +1,16 @@
+#include "vault.ih"
+
+void Vault::enableConcurrentReads(size_t readers)
+{                                      // readers only run alongside a 
+    if (d_durability.journalMode != "WAL")    // writer in WAL mode
+    {
+        Durability profile = d_durability;
+        profile.journalMode = "WAL";
+        setDurability(profile);
+    }
+
+    d_readers = make_unique<ConnectionPool>(
+                        sqlite3_db_filename(d_db, "main"), d_durability,
+                        readers);
+    publishKey();
+}
@@ -1,18 +1,13 @@
 #include "vault.ih"
 
 void Vault::ensureSchema()
-{                                      // Table for the encrypted entries; 
-    string const sqlCommand =          // (Website, UserIdentifier) pair is unique
-        "CREATE TABLE IF NOT EXISTS Vault (\n"
-        "    Website        varchar(255) NOT NULL,\n"
-        "    UserIdentifier varchar(255) NOT NULL,\n"
-        "    nonce          blob NOT NULL,\n"
-        "    tag            blob NOT NULL,\n"
-        "    ciphertext     blob NOT NULL\n,"
-        "    UNIQUE (Website, UserIdentifier)\n"
-        ");";
-                                       // Meta table for KDF salt and 
-    string const sqlMeta =             // password verifier
+{                                      // only affects a new, empty file:
+    d_db.exec("PRAGMA auto_vacuum=INCREMENTAL;");   // compact can then
+                                       // release free pages cheaply
+                                       // Table for the encrypted entries;
+    string const sqlCommand = vaultTableSql("Vault");
+                                       // Meta table for KDF salt, key check
+    string const sqlMeta =             // value and settings
         "CREATE TABLE IF NOT EXISTS meta (\n"
         "   Key varchar(255) PRIMARY KEY,\n"
         "   Value blob NOT NULL\n"
@@ -29,4 +24,8 @@ void Vault::ensureSchema()
         sqlite3_free(errmsg);          // allocated by SQLite 
         throw runtime_error("Schema error: " + errorMessage);
     }
-}
\ No newline at end of file
+                                       // vaults from before the version 
+    if (readMeta("schema_version")     // field have the rowid layout
+            != to_string(SCHEMA_VERSION))
+        migrateSchema();
+}
@@ -0,0 +1,121 @@
+#include "vault.ih"
+
+namespace
+{
+    using Slot = SnapshotVault::Slot;
+
+    uint64_t pageAligned(uint64_t offset)
+    {
+        return (offset + SnapshotVault::PAGE_SIZE - 1) 
+               / SnapshotVault::PAGE_SIZE * SnapshotVault::PAGE_SIZE;
+    }
+
+    template <typename Type>
+    void writeAt(ofstream &out, uint64_t offset, span<Type const> items)
+    {
+        out.seekp(offset);
+        out.write(reinterpret_cast<char const *>(items.data()), 
+                  items.size_bytes());
+    }
+}
+
+size_t Vault::exportSnapshot(string const &filename, string &master)
+{
+    if (!d_key.valid())
+        throw runtime_error("The vault is locked. If you want to export a "
+                            "snapshot, you have to unlock it first.");
+
+    if (filesystem::exists(filename))  // e.g. the vault itself
+    {
+        sodium_memzero(master.data(), master.size());
+        throw runtime_error(filename + " already exists");
+    }
+
+    Key const kek = checkMaster(master);
+    sodium_memzero(master.data(), master.size());
+
+    Key const snapshotKey = randomKey();
+    Key const locatorKey = SnapshotVault::locatorKey(snapshotKey);
+                                       // the layout follows from the count
+    size_t const count = queryNumber("SELECT count(*) FROM Vault;");
+    SnapshotVault::Header header{};
+    header.count = count;
+    header.displacementOffset = SnapshotVault::PAGE_SIZE;
+    header.slotOffset = pageAligned(header.displacementOffset 
+                            + PerfectHash::buckets(count) * sizeof(uint32_t));
+    header.recordOffset = pageAligned(header.slotOffset 
+                                      + count * sizeof(Slot));
+
+    string const scratch = filename + ".part";
+    createPrivate(scratch);
+    try
+    {
+        ofstream out(scratch, ios::binary);
+        out.seekp(header.recordOffset);
+                                       // records stream out as decrypted;
+        vector<Slot> slots;            // only the slots stay in memory
+        slots.reserve(count);
+        uint64_t offset = header.recordOffset;
+        forEach([&](Credential const &credential)
+        {
+            Slot slot{};
+            slot.locator = SnapshotVault::locator(locatorKey, 
+                                                  credential.website,
+                                                  credential.userIdentifier);
+            SecureBytes const sealed = SnapshotVault::seal(snapshotKey, 
+                                                slot.locator, 
+                                                credential.password.data());
+            out.write(reinterpret_cast<char const *>(sealed.data()), 
+                      sealed.size());
+
+            slot.offset = offset;
+            slot.size = sealed.size();
+            slots.push_back(slot);
+            offset += sealed.size();
+        });
+        if (slots.size() != count)
+            throw runtime_error("The vault changed during the export");
+
+        vector<PerfectHash::Hash> hashes;
+        hashes.reserve(count);
+        for (Slot const &slot: slots)
+            hashes.push_back(SnapshotVault::hashOf(slot.locator));
+
+        auto const [seed, displacements] = PerfectHash::build(hashes);
+        PerfectHash const hash(seed, count, displacements);
+        vector<Slot> ordered(count);   // slot i holds the entry hashing to i
+        for (size_t idx = 0; idx != count; ++idx)
+            ordered[hash.slot(hashes[idx])] = slots[idx];
+
+        memcpy(header.magic, SnapshotVault::MAGIC, sizeof header.magic);
+        header.version = SnapshotVault::VERSION;
+        header.seed = seed;
+        header.fileSize = offset;
+        header.opsLimit = d_kdf.opsLimit;
+        header.memLimit = d_kdf.memLimit;
+        vector<uint8_t> const salt = loadOrCreateSalt();
+        memcpy(header.salt, salt.data(), sizeof header.salt);
+        SnapshotVault::wrap(snapshotKey, kek, header.wrappedKey);
+
+        writeAt(out, 0, span<SnapshotVault::Header const>(&header, 1));
+        writeAt(out, header.displacementOffset, 
+                span<uint32_t const>(displacements));
+        writeAt(out, header.slotOffset, span<Slot const>(ordered));
+        if (!out.flush())
+            throw runtime_error("Writing " + scratch + " failed");
+        out.close();                   // pads a snapshot without records
+        filesystem::resize_file(scratch, offset);     // to its first page
+                                       // unlike rename, link fails if a
+        if (link(scratch.c_str(), filename.c_str()) != 0)  // file appeared
+            throw runtime_error("Cannot create " + filename + ": "
+                                + strerror(errno));
+        filesystem::remove(scratch);
+        return count;
+    }
+    catch (...)
+    {
+        error_code ignored;
+        filesystem::remove(scratch, ignored);
+        throw;
+    }
+}
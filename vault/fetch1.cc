@@ -0,0 +1,14 @@
+#include "vault.ih"
+
+optional<Secret> Vault::fetch(DbHandle const &db, Key const *key, 
+                              string const &website,
+                              string const &userIdentifier) const
+{
+    optional<Statement> const row = locate(db, key, website, userIdentifier);
+    if (!row)
+        return nullopt;
+                                       // nonce, tag and cipher, read in place
+    return decrypt(*key, website, userIdentifier, 
+                   columnBlob(*row, 0), columnBlob(*row, 1), 
+                   columnBlob(*row, 2));
+}
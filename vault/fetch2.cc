@@ -0,0 +1,13 @@
+#include "vault.ih"
+
+size_t Vault::fetch(DbHandle const &db, Key const *key, string const &website,
+                    string const &userIdentifier, span<char> out) const
+{
+    optional<Statement> const row = locate(db, key, website, userIdentifier);
+    if (!row)
+        throw missing(website, userIdentifier);
+
+    return decrypt(*key, website, userIdentifier, 
+                   columnBlob(*row, 0), columnBlob(*row, 1), 
+                   columnBlob(*row, 2), out);
+}
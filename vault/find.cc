@@ -0,0 +1,34 @@
+#include "vault.ih"
+
+optional<Secret> Vault::find(string const &website, 
+                              string const &userIdentifier) const
+{
+    StageStats::Timer const timer(StageStats::GET);
+
+    SecureBytes const names = d_cache ? joinNames(website, userIdentifier)
+                                      : SecureBytes{};
+    string_view const name(reinterpret_cast<char const *>(names.data()), 
+                           names.size());
+    uint64_t generation = 0;
+    if (d_cache)
+    {
+        if (optional<Secret> hit = d_cache->find(name))
+            return move(*hit);
+        generation = d_cache->generation();
+    }
+
+    optional<Secret> password = [&]
+    {
+        if (!d_readers)                // single-threaded: own connection
+            return fetch(d_db, &d_key, website, userIdentifier);
+                                       // pin the key: a concurrent lock 
+                                       // wipes it only after this lookup
+        shared_ptr<Key const> const key = d_sharedKey.load();
+        ConnectionPool::Lease const lease = d_readers->acquire();
+        return fetch(lease.db(), key.get(), website, userIdentifier);
+    }();
+
+    if (d_cache && password)
+        d_cache->insert(name, password->data(), generation);
+    return password;
+}
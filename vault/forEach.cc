@@ -0,0 +1,81 @@
+#include "vault.ih"
+
+namespace
+{
+    struct Sealed                      // one row as stored, plus its 
+    {                                  // decryption
+        string website;
+        string userIdentifier;
+        vector<uint8_t> nonce;
+        vector<uint8_t> tag;
+        vector<uint8_t> cipher;
+        optional<Secret> plain;
+    };
+
+    void load(Sealed &row, sqlite3_stmt *statement)
+    {
+        auto text = [&](int col, string &out)
+        {
+            out.assign(reinterpret_cast<char const *>(
+                                        sqlite3_column_blob(statement, col)),
+                       sqlite3_column_bytes(statement, col));
+        };
+        auto blob = [&](int col, vector<uint8_t> &out)
+        {
+            auto ptr = static_cast<uint8_t const *>(
+                                        sqlite3_column_blob(statement, col));
+            out.assign(ptr, ptr + sqlite3_column_bytes(statement, col));
+        };
+
+        text(0, row.website);
+        text(1, row.userIdentifier);
+        blob(2, row.nonce);
+        blob(3, row.tag);
+        blob(4, row.cipher);
+    }
+}
+
+void Vault::forEach(function<void(Credential const &)> const &sink,
+                    size_t batchSize, size_t threads) const
+{
+    if (!d_key.valid())
+        throw runtime_error("The vault is locked. If you want to read its "
+                            "entries, you have to unlock it first.");
+
+    char constexpr allEntriesSql[] = 
+        "SELECT   Website, UserIdentifier, nonce, tag, ciphertext "
+        "FROM     Vault "
+        "ORDER BY Website, UserIdentifier;";
+
+    Statement statement = d_db.prepare(allEntriesSql);
+    WorkerPool pool(threads);
+                                       // the batch is reused: memory stays 
+    vector<Sealed> batch(max<size_t>(batchSize, 1));   // flat
+    
+    for (int result = SQLITE_ROW; result == SQLITE_ROW; )
+    {
+        size_t filled = 0;             // read one batch of sealed rows
+        while (filled != batch.size()
+               && (result = sqlite3_step(statement.ptr)) == SQLITE_ROW)
+            load(batch[filled++], statement.ptr);
+
+        if (result != SQLITE_ROW && result != SQLITE_DONE)
+            throw runtime_error("SQLite step failed: " 
+                                + string(sqlite3_errmsg(d_db)));
+                                       // decrypt it in parallel
+        pool.run(filled, [&](size_t idx)
+            {
+                Sealed &row = batch[idx];
+                if (d_blinded)
+                    tie(row.website, row.userIdentifier) = 
+                        openNames(d_key, row.website, row.userIdentifier);
+                row.plain = decrypt(d_key, row.website, row.userIdentifier,
+                                    row.nonce, row.tag, row.cipher);
+            }
+        );
+                                       // and hand it out in order
+        for (Sealed &row: span(batch).first(filled))
+            sink(Credential{ move(row.website), move(row.userIdentifier), 
+                             move(*row.plain) });
+    }
+}
@@ -0,0 +1,9 @@
+#include "vault.ih"
+
+Secret Vault::get(string const &website, string const &userIdentifier) const
+{
+    optional<Secret> password = find(website, userIdentifier);
+    if (!password)
+        throw missing(website, userIdentifier);
+    return move(*password);
+}
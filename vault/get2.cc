@@ -0,0 +1,15 @@
+#include "vault.ih"
+
+size_t Vault::get(string const &website, string const &userIdentifier,
+                  span<char> out) const
+{
+    StageStats::Timer const timer(StageStats::GET);
+
+    if (!d_readers)                    // single-threaded: own connection
+        return fetch(d_db, &d_key, website, userIdentifier, out);
+                                       // pin the key: a concurrent lock 
+                                       // wipes it only after this lookup
+    shared_ptr<Key const> const key = d_sharedKey.load();
+    ConnectionPool::Lease const lease = d_readers->acquire();
+    return fetch(lease.db(), key.get(), website, userIdentifier, out);
+}
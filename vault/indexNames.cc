@@ -0,0 +1,8 @@
+#include "vault.ih"
+
+void Vault::indexNames(string_view website, string_view userIdentifier)
+{
+    lock_guard lock(d_namesMutex);
+    if (d_names)                       // else read when first needed
+        d_names->insert(website, userIdentifier);
+}
@@ -0,0 +1,19 @@
+#include "vault.ih"
+
+void Vault::initialize(string &master, KdfParams const &params)
+{
+    params.validate();
+                                       // salt, cost, wrapped data key and 
+    Transaction transaction(d_db);     // key check value are stored 
+    writeKdfParams(params);            // together or not at all
+    d_kdf = params;
+                                       // a random data key, wrapped by the
+    Key const kek = deriveKek(master, loadOrCreateSalt(), params);  // KEK
+    sodium_memzero(master.data(), master.size());
+    d_key = randomKey();
+    writeMeta("dek", wrapKey(d_key, kek));
+                                       // store the key check value that
+    storeKeyCheck();                   // authenticates the data key
+    transaction.commit();
+    publishKey();
+}
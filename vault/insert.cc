@@ -0,0 +1,29 @@
+#include "vault.ih"
+
+Secret Vault::insert(string const &website, string const &userIdentifier,
+                     function<Secret()> const &generate)
+{
+    StageStats::Timer const timer(StageStats::ADD);
+
+    if (!d_key.valid())
+        throw runtime_error("The vault is locked. If you want to add an entry, "
+                            "you have to unlock it first.");
+
+    shared_ptr<BreachIndex const> const breaches = this->breaches();
+    Secret password = generate();
+    for (size_t draws = 1; breaches && breaches->contains(password.data());
+         ++draws)
+    {
+        if (draws == MAX_DRAWS)        // the policy's passwords are too few
+            throw runtime_error("Every generated password was found in the "
+                                "breach corpus: use a longer password "
+                                "policy.");
+        password = generate();
+    }
+    {
+        lock_guard lock(d_writeMutex);
+        store(d_key, website, userIdentifier, password.data());
+    }
+    committed(website, userIdentifier);
+    return password;
+}
@@ -0,0 +1,40 @@
+#include "vault.ih"
+
+size_t Vault::installKey(optional<Key> next, Key const &kek, 
+                         span<uint8_t const> salt, KdfParams const &params)
+{
+    Transaction transaction(d_db);     // entries, salt, cost and wrapped 
+    size_t count = 0;                  // key change together or not at all
+    if (next)
+    {
+        count = rewrite(*next, d_blinded);
+        d_meta.reset();
+        d_db.exec("DELETE FROM meta WHERE key='dek_recovery';");
+    }
+    writeMeta("salt", string_view(reinterpret_cast<char const *>(salt.data()),
+                                  salt.size()));
+    writeKdfParams(params);
+    writeMeta("dek", wrapKey(next ? *next : d_key, kek));
+
+    if (!next)
+    {
+        transaction.commit();
+        return 0;
+    }
+
+    Key previous = move(d_key);
+    d_key = move(*next);
+    try
+    {
+        storeKeyCheck();
+        transaction.commit();
+    }
+    catch (...)                        // rolled back: keep the old key
+    {
+        d_key = move(previous);
+        throw;
+    }
+
+    publishKey();
+    return count;
+}
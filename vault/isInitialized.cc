@@ -2,5 +2,5 @@
 
 bool Vault::isInitialized() const
 {
-    return getVerifier().has_value();
-}
\ No newline at end of file
+    return readMeta("kcv").has_value() || getVerifier().has_value();
+}
@@ -0,0 +1,10 @@
+#include "vault.ih"
+                                       // static
+SecureBytes Vault::joinNames(string_view website, string_view userIdentifier)
+{
+    SecureBytes names(website.size() + 1 + userIdentifier.size());
+    auto next = ranges::copy(website, names.begin()).out;
+    *next++ = '\0';
+    ranges::copy(userIdentifier, next);
+    return names;
+}
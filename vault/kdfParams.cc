@@ -0,0 +1,6 @@
+#include "vault.ih"
+
+KdfParams const &Vault::kdfParams() const
+{
+    return d_kdf;
+}
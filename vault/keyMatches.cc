@@ -0,0 +1,18 @@
+#include "vault.ih"
+
+bool Vault::keyMatches(string const &check) const
+{
+    if (check.size() != KEY_CHECK_SIZE)
+        throw runtime_error("Invalid key check value in DB");
+
+    auto const *nonce = reinterpret_cast<unsigned char const *>(check.data());
+    return crypto_aead_xchacha20poly1305_ietf_decrypt(
+                /*m=*/nullptr, nullptr,
+                /*nsec=*/nullptr,
+                nonce + crypto_aead_xchacha20poly1305_ietf_NPUBBYTES,
+                crypto_aead_xchacha20poly1305_ietf_ABYTES,
+                reinterpret_cast<unsigned char const *>(KEY_CHECK_AD), 
+                sizeof KEY_CHECK_AD - 1,
+                nonce,
+                d_key.data()) == 0;
+}
@@ -0,0 +1,7 @@
+#include "vault.ih"
+
+vector<pair<string, string>> Vault::list() const
+{
+    lock_guard lock(d_namesMutex);
+    return names().list();
+}
@@ -0,0 +1,20 @@
+#include "vault.ih"
+
+Durability Vault::loadDurability() const
+{
+    Durability profile;                // absent keys keep SQLite's defaults
+
+    if (auto value = readMeta("journal_mode"))
+        profile.journalMode = *value;
+    if (auto value = readMeta("synchronous"))
+        profile.synchronous = *value;
+    if (auto value = readMeta("mmap_size"))
+        profile.mmapSize = stoll(*value);
+    if (auto value = readMeta("cache_size"))
+        profile.cacheSize = stoll(*value);
+    if (auto value = readMeta("page_size"))
+        profile.pageSize = stoll(*value);
+
+    profile.validate();                // the values end up in PRAGMAs
+    return profile;
+}
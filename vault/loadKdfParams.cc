@@ -0,0 +1,14 @@
+#include "vault.ih"
+
+KdfParams Vault::loadKdfParams() const
+{
+    KdfParams params;                  // vaults from before per-vault costs
+                                       // used the MODERATE defaults
+    if (auto value = readMeta("kdf_opslimit"))
+        params.opsLimit = stoull(*value);
+    if (auto value = readMeta("kdf_memlimit"))
+        params.memLimit = stoull(*value);
+
+    params.validate();
+    return params;
+}
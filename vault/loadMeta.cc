@@ -0,0 +1,30 @@
+#include "vault.ih"
+
+optional<Vault::Meta> Vault::loadMeta() const
+{                                      // run once per open: not cached
+    sqlite3_stmt *statement = nullptr;
+    if (sqlite3_prepare_v2(d_db, "SELECT key, value FROM meta;", -1,
+                           &statement, nullptr) != SQLITE_OK)
+    {                                  // a new file: no meta table yet
+        sqlite3_finalize(statement);
+        return nullopt;
+    }
+
+    Meta meta;
+    int result;
+    while ((result = sqlite3_step(statement)) == SQLITE_ROW)
+    {
+        char const *key = reinterpret_cast<char const *>(
+                                            sqlite3_column_text(statement, 0));
+        void const *blob = sqlite3_column_blob(statement, 1);
+        size_t const size = sqlite3_column_bytes(statement, 1);
+        meta.emplace(key ? key : "", 
+                     string(static_cast<char const *>(blob), size));
+    }
+    sqlite3_finalize(statement);
+
+    if (result != SQLITE_DONE)
+        throw runtime_error("Reading the meta table failed: " 
+                            + string(sqlite3_errmsg(d_db)));
+    return meta;
+}
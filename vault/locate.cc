@@ -0,0 +1,35 @@
+#include "vault.ih"
+
+optional<Statement> Vault::locate(DbHandle const &db, Key const *key, 
+                                  string const &website,
+                                  string const &userIdentifier) const
+{
+    if (key == nullptr || !key->valid())
+        throw runtime_error("The vault is locked. If you want to fetch a "
+                            "password, you have to unlock it first.");
+
+    char constexpr fetchPassSql[] =    // pull record
+        "SELECT nonce, tag, ciphertext "
+        "FROM   Vault "
+        "WHERE  Website=?1 AND UserIdentifier=?2;";
+                                       // blinded or not: one probe of the
+    auto const [websiteColumn, userColumn] =          // unique index
+                                columnNames(*key, website, userIdentifier);
+
+    Statement statement = StageStats::time(StageStats::PREPARE, [&]
+                          {
+                              return db.prepare(fetchPassSql);
+                          });
+                                       // copied: the statement outlives
+    bindName(statement.ptr, 1, websiteColumn, SQLITE_TRANSIENT);  // them
+    bindName(statement.ptr, 2, userColumn, SQLITE_TRANSIENT);
+    int const result = StageStats::time(StageStats::STEP, [&]
+                       {
+                           return sqlite3_step(statement.ptr);
+                       });
+    if (result == SQLITE_ROW)
+        return statement;
+    if (result == SQLITE_DONE)         // no such entry; anything else is a
+        return nullopt;                // busy, failing or corrupt vault
+    throw runtime_error("SQLite lookup failed: " + string(sqlite3_errmsg(db)));
+}
@@ -0,0 +1,6 @@
+#include "vault.ih"
+
+void Vault::lock()
+{
+    wipeKey();
+}
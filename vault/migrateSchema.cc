@@ -0,0 +1,25 @@
+#include "vault.ih"
+
+void Vault::migrateSchema()
+{
+    {
+        Transaction transaction(d_db);
+                                       // a new vault already has the 
+        if (queryNumber(               // clustered table
+                "SELECT count(*) FROM sqlite_master "
+                "WHERE name='Vault' AND sql LIKE '%WITHOUT ROWID%';") == 0)
+            d_db.exec(
+                vaultTableSql("VaultV2") +
+                "INSERT INTO VaultV2 "
+                "   SELECT Website, UserIdentifier, nonce, tag, ciphertext "
+                "   FROM Vault;"
+                "DROP TABLE Vault;"
+                "ALTER TABLE VaultV2 RENAME TO Vault;");
+
+        writeMeta("schema_version", to_string(SCHEMA_VERSION));
+        transaction.commit();
+    }
+                                       // 2: INCREMENTAL; switching an
+    if (queryNumber("PRAGMA auto_vacuum;") != 2)   // existing file takes 
+        d_db.exec("PRAGMA auto_vacuum=INCREMENTAL; VACUUM;");   // a rebuild
+}
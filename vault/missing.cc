@@ -0,0 +1,8 @@
+#include "vault.ih"
+
+runtime_error Vault::missing(string const &website, 
+                             string const &userIdentifier)
+{
+    return runtime_error("No password stored for “" + website
+                         + "” / user “" + userIdentifier + "”.");
+}
@@ -0,0 +1,43 @@
+#include "vault.ih"
+
+TrigramIndex const &Vault::names() const
+{
+    if (!d_key.valid())
+        throw runtime_error("The vault is locked. If you want to search its "
+                            "entries, you have to unlock it first.");
+    if (d_names)
+        return *d_names;
+                                       // only the names: no decryption of
+    Statement statement = d_db.prepare(   // passwords (names only if the
+        "SELECT Website, UserIdentifier FROM Vault;");   // vault is blinded)
+
+    auto index = make_unique<TrigramIndex>();
+    int result;
+    while ((result = sqlite3_step(statement.ptr)) == SQLITE_ROW)
+    {
+        auto column = [&](int col)
+        {
+            return string(reinterpret_cast<char const *>(
+                                    sqlite3_column_blob(statement.ptr, col)),
+                          sqlite3_column_bytes(statement.ptr, col));
+        };
+
+        if (d_blinded)
+        {
+            auto [website, userIdentifier] = 
+                                    openNames(d_key, column(0), column(1));
+            index->insert(website, userIdentifier);
+            sodium_memzero(website.data(), website.size());
+            sodium_memzero(userIdentifier.data(), userIdentifier.size());
+        }
+        else
+            index->insert(column(0), column(1));
+    }
+
+    if (result != SQLITE_DONE)
+        throw runtime_error("SQLite step failed: " 
+                            + string(sqlite3_errmsg(d_db)));
+
+    d_names = move(index);
+    return *d_names;
+}
@@ -0,0 +1,28 @@
+#include "vault.ih"
+
+pair<string, string> Vault::openNames(Key const &key, string const &locator,
+                                      string const &sealed) const
+{
+    size_t const tagSize = crypto_aead_xchacha20poly1305_ietf_ABYTES;
+    if (locator.size() != LOCATOR_SIZE || sealed.size() < tagSize)
+        throw runtime_error("Malformed blinded entry.");
+
+    SecureBytes names(sealed.size() - tagSize);
+    Key const namesKey = subkey(key, NAMES_KEY);
+                                       // the locator is the nonce: moving
+    if (crypto_aead_xchacha20poly1305_ietf_decrypt(   // names to another 
+            names.data(), nullptr,     // locator fails authentication
+            nullptr,
+            reinterpret_cast<unsigned char const *>(sealed.data()),
+            sealed.size(), nullptr, 0,
+            reinterpret_cast<unsigned char const *>(locator.data()),
+            namesKey.data()) != 0)
+        throw runtime_error("Decryption failed: blinded names are corrupted "
+                            "or were tampered with.");
+
+    auto const split = ranges::find(names, '\0');
+    if (split == names.end())
+        throw runtime_error("Malformed blinded entry.");
+
+    return { string(names.begin(), split), string(split + 1, names.end()) };
+}
@@ -0,0 +1,18 @@
+#include "vault.ih"
+
+void Vault::publishKey()
+{
+    if (!d_readers)
+        return;
+
+    if (!d_key.valid())
+    {                                  // readers still holding the old copy
+        d_sharedKey.store(nullptr);    // finish; the last one wipes it
+        return;
+    }
+
+    auto copy = make_shared<Key>();
+    memcpy(copy->data(), d_key.data(), d_key.size());
+    copy->setValid(true);
+    d_sharedKey.store(move(copy));
+}
@@ -0,0 +1,10 @@
+#include "vault.ih"
+
+long long Vault::queryNumber(string_view sql) const
+{
+    Statement statement = d_db.prepare(sql);
+    if (sqlite3_step(statement.ptr) != SQLITE_ROW)
+        throw runtime_error("SQLite query failed: " 
+                            + string(sqlite3_errmsg(d_db)));
+    return sqlite3_column_int64(statement.ptr, 0);
+}
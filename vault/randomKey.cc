@@ -0,0 +1,9 @@
+#include "vault.ih"
+
+Key Vault::randomKey()
+{
+    Key key;
+    crypto_aead_xchacha20poly1305_ietf_keygen(key.data());
+    key.setValid(true);
+    return key;
+}
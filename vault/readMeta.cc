@@ -0,0 +1,25 @@
+#include "vault.ih"
+
+optional<string> Vault::readMeta(string_view key) const
+{
+    if (d_meta)                        // loaded at open and unchanged since
+    {
+        auto const iter = d_meta->find(key);
+        if (iter == d_meta->end())
+            return nullopt;
+        return iter->second;
+    }
+
+    char constexpr readMetaSql[] = 
+        "SELECT value FROM meta WHERE key=?1;";
+
+    Statement statement = d_db.prepare(readMetaSql);
+    sqlite3_bind_text(statement.ptr, 1, key.data(), key.size(), SQLITE_STATIC);
+
+    if (sqlite3_step(statement.ptr) != SQLITE_ROW)
+        return nullopt;
+
+    void const *blob = sqlite3_column_blob(statement.ptr, 0);
+    size_t const size = sqlite3_column_bytes(statement.ptr, 0);
+    return string(static_cast<char const *>(blob), size);
+}
@@ -0,0 +1,22 @@
+#include "vault.ih"
+
+optional<Key> Vault::recoveryKek(string_view credential)
+{
+    if (!credential.starts_with(RECOVERY_PREFIX))
+        return nullopt;
+    credential.remove_prefix(sizeof RECOVERY_PREFIX - 1);
+
+    SecureBytes raw(RECOVERY_SIZE);
+    size_t length = 0;
+    if (sodium_hex2bin(raw.data(), raw.size(), credential.data(), 
+                       credential.size(), "-", &length, nullptr) != 0
+        || length != raw.size())
+        return nullopt;
+                                       // the key is random: a keyed hash,
+    Key kek;                           // not Argon2, makes it a KEK
+    crypto_generichash(kek.data(), kek.size(), raw.data(), raw.size(),
+                       reinterpret_cast<unsigned char const *>(RECOVERY_AD),
+                       sizeof RECOVERY_AD - 1);
+    kek.setValid(true);
+    return kek;
+}
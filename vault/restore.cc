@@ -0,0 +1,56 @@
+#include "vault.ih"
+
+size_t Vault::restore(string const &archive, string const &filename, 
+                      string &password)
+{
+    if (filesystem::exists(filename))
+    {
+        sodium_memzero(password.data(), password.size());
+        throw runtime_error(filename + " already exists");
+    }
+
+    string const scratch = filename + ".part";
+    ifstream in(archive, ios::binary);
+    if (!in)
+    {
+        sodium_memzero(password.data(), password.size());
+        throw runtime_error("Cannot read " + archive);
+    }
+    bool scratchCreated = false;
+    try
+    {                                  // a stale .part file is left alone
+        createPrivate(scratch);
+        scratchCreated = true;
+
+        size_t size;
+        {
+            ofstream out(scratch, ios::binary | ios::trunc);
+            size = Archive::open(in, out, password);
+            sodium_memzero(password.data(), password.size());
+            if (!out.flush())
+                throw runtime_error("Writing " + scratch + " failed");
+        }
+        {                              // authenticated, now also sane?
+            DbHandle const restored(scratch, SQLITE_OPEN_READWRITE);
+            Statement check = restored.prepare("PRAGMA quick_check;");
+            if (sqlite3_step(check.ptr) != SQLITE_ROW 
+                || string_view(reinterpret_cast<char const *>(
+                                sqlite3_column_text(check.ptr, 0))) != "ok")
+                throw runtime_error("The restored database is damaged");
+        }                              // (closing removes a WAL file)
+                                       // unlike rename, link fails if a
+        if (link(scratch.c_str(), filename.c_str()) != 0)  // vault appeared
+            throw runtime_error("Cannot create " + filename + ": "
+                                + strerror(errno));
+        filesystem::remove(scratch);
+        return size;
+    }
+    catch (...)
+    {
+        sodium_memzero(password.data(), password.size());
+        error_code ignored;            // only the file created here
+        if (scratchCreated)
+            filesystem::remove(scratch, ignored);
+        throw;
+    }
+}
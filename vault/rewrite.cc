@@ -0,0 +1,61 @@
+#include "vault.ih"
+
+size_t Vault::rewrite(Key const &next, bool blinded)
+{                                      // iterate over a copy: rewritten 
+    d_db.exec(                         // rows may sort after the cursor
+        "CREATE TEMP TABLE Rewrite AS "
+        "   SELECT Website, UserIdentifier, nonce, tag, ciphertext "
+        "   FROM Vault;");
+
+    char constexpr everyEntrySql[] = 
+        "SELECT Website, UserIdentifier, nonce, tag, ciphertext "
+        "FROM   temp.Rewrite;";
+    char constexpr dropEntrySql[] = 
+        "DELETE FROM Vault WHERE Website=?1 AND UserIdentifier=?2;";
+                                       // read in the old format, store in
+    bool const wasBlinded = exchange(d_blinded, blinded);     // the new one
+
+    size_t count = 0;
+    {
+        Statement const row = d_db.prepare(everyEntrySql);
+        auto text = [&](int col)
+        {
+            return string(reinterpret_cast<char const *>(
+                                        sqlite3_column_blob(row.ptr, col)),
+                          sqlite3_column_bytes(row.ptr, col));
+        };
+
+        int result;
+        while ((result = sqlite3_step(row.ptr)) == SQLITE_ROW)
+        {
+            string website = text(0);
+            string userIdentifier = text(1);
+            if (wasBlinded)
+                tie(website, userIdentifier) = 
+                                    openNames(d_key, website, userIdentifier);
+
+            Secret const password = decrypt(d_key, website, userIdentifier, 
+                                            columnBlob(row, 2), 
+                                            columnBlob(row, 3), 
+                                            columnBlob(row, 4));
+            {                          // a new key changes a blinded row's
+                                       // names: drop the old row first
+                Statement drop = d_db.prepare(dropEntrySql);
+                sqlite3_bind_value(drop.ptr, 1, sqlite3_column_value(row.ptr, 0));
+                sqlite3_bind_value(drop.ptr, 2, sqlite3_column_value(row.ptr, 1));
+                if (sqlite3_step(drop.ptr) != SQLITE_DONE)
+                    throw runtime_error("SQLite delete failed: " 
+                                        + string(sqlite3_errmsg(d_db)));
+            }
+            store(next, website, userIdentifier, password.data());
+            ++count;
+        }
+
+        if (result != SQLITE_DONE)
+            throw runtime_error("SQLite step failed: " 
+                                + string(sqlite3_errmsg(d_db)));
+    }                                  // reset before the table goes
+
+    d_db.exec("DROP TABLE temp.Rewrite;");
+    return count;
+}
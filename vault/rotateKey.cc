@@ -0,0 +1,32 @@
+#include "vault.ih"
+
+size_t Vault::rotateKey(string &master, size_t batchSize, size_t threads,
+                        function<void(size_t, size_t)> const &progress)
+{
+    if (!d_key.valid())
+        throw runtime_error("The vault is locked. If you want to rotate its "
+                            "key, you have to unlock it first.");
+
+    lock_guard lock(d_writeMutex);
+
+    if (!readMeta("rotate_key"))       // else: finish the pending one
+    {
+        Key const kek = checkMaster(master);
+        Key const next = randomKey();
+                                       // the plan, all or nothing: resuming
+        Transaction transaction(d_db); // needs only the current key
+        writeMeta("rotate_key", wrapKey(next, d_key));
+        writeMeta("rotate_dek", wrapKey(next, kek));
+        writeMeta("rotate_done", "0");
+        d_db.exec(
+            "CREATE TABLE RotationQueue ("
+            "   Website TEXT NOT NULL, UserIdentifier TEXT NOT NULL, "
+            "   PRIMARY KEY (Website, UserIdentifier)) WITHOUT ROWID;"
+            "INSERT INTO RotationQueue SELECT Website, UserIdentifier "
+            "   FROM Vault;");
+        transaction.commit();
+    }
+    sodium_memzero(master.data(), master.size());
+
+    return continueRotation(batchSize, threads, progress);
+}
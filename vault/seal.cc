@@ -0,0 +1,30 @@
+#include "vault.ih"
+
+SecureBytes Vault::seal(Key const &key, 
+                        string const &website, string const &userIdentifier,
+                        string_view password) const
+{                                      // v2 row: nonce || cipher || tag in
+    size_t const nonceSize = crypto_aead_xchacha20poly1305_ietf_NPUBBYTES;
+                                       // one blob from the secure arena
+    SecureBytes sealed(nonceSize + password.size() 
+                       + crypto_aead_xchacha20poly1305_ietf_ABYTES);
+                                       // 24-byte random nonce
+    randombytes_buf(sealed.data(), nonceSize);
+                                       
+    SecureBytes const ad = joinNames(website, userIdentifier);
+    StageStats::time(StageStats::ENCRYPT, [&]
+    {
+        return crypto_aead_xchacha20poly1305_ietf_encrypt_detached(
+            sealed.data() + nonceSize, // cipher, followed by the 16-byte tag
+            sealed.data() + nonceSize + password.size(), nullptr,
+            reinterpret_cast<unsigned char const *>(password.data()),
+            password.size(),
+            ad.data(), ad.size(),
+            /*nsec=*/nullptr,
+            sealed.data(),
+            key.data()
+        );
+    });
+
+    return sealed;
+}
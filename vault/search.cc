@@ -0,0 +1,8 @@
+#include "vault.ih"
+
+vector<TrigramIndex::Match> Vault::search(string_view fragment, 
+                                          size_t limit) const
+{
+    lock_guard lock(d_namesMutex);
+    return names().search(fragment, limit);
+}
@@ -0,0 +1,25 @@
+#include "vault.ih"
+
+size_t Vault::setBlinded(bool blinded)
+{
+    if (!d_key.valid())
+        throw runtime_error("The vault is locked. If you want to convert it, "
+                            "you have to unlock it first.");
+
+    if (blinded == d_blinded)
+        return 0;
+
+    try
+    {
+        Transaction transaction(d_db);
+        size_t const count = rewrite(d_key, blinded);
+        writeMeta("blinded", blinded ? "1" : "0");
+        transaction.commit();
+        return count;
+    }
+    catch (...)                        // rolled back: the old format stays
+    {
+        d_blinded = !blinded;
+        throw;
+    }
+}
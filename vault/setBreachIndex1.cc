@@ -0,0 +1,8 @@
+#include "vault.ih"
+
+void Vault::setBreachIndex(shared_ptr<BreachIndex const> breaches)
+{
+    lock_guard lock(d_breachMutex);
+    d_openBreaches = nullptr;
+    d_breaches = move(breaches);
+}
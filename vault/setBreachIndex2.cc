@@ -0,0 +1,8 @@
+#include "vault.ih"
+
+void Vault::setBreachIndex(function<shared_ptr<BreachIndex const>()> open)
+{
+    lock_guard lock(d_breachMutex);
+    d_openBreaches = move(open);
+    d_breaches.reset();
+}
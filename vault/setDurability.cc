@@ -0,0 +1,45 @@
+#include "vault.ih"
+
+void Vault::setDurability(Durability const &profile)
+{
+    profile.validate();
+
+    long long currentPageSize = 0;
+    {
+        Statement statement = d_db.prepare("PRAGMA page_size;");
+        if (sqlite3_step(statement.ptr) == SQLITE_ROW)
+            currentPageSize = sqlite3_column_int64(statement.ptr, 0);
+    }
+
+    try
+    {                                  // an existing file only gets a new
+                                       // page size when it is rebuilt, and
+                                       // WAL mode does not allow that
+        if (currentPageSize != profile.pageSize)
+            d_db.exec("PRAGMA journal_mode=DELETE;"
+                      "PRAGMA page_size=" + to_string(profile.pageSize) + ";"
+                      "VACUUM;");
+
+        profile.apply(d_db);
+                                       // stored only once it took effect:
+        Transaction transaction(d_db); // the next open applies the meta
+        writeMeta("journal_mode", profile.journalMode);
+        writeMeta("synchronous",  profile.synchronous);
+        writeMeta("mmap_size",    to_string(profile.mmapSize));
+        writeMeta("cache_size",   to_string(profile.cacheSize));
+        writeMeta("page_size",    to_string(profile.pageSize));
+        transaction.commit();
+    }
+    catch (...)
+    {                                  // the meta rows still hold the old
+        try                            // profile: back to its pragmas, but
+        {                              // report the first error
+            d_durability.apply(d_db);
+        }
+        catch (...)
+        {}
+        throw;
+    }
+
+    d_durability = profile;
+}
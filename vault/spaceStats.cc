@@ -0,0 +1,11 @@
+#include "vault.ih"
+
+SpaceStats Vault::spaceStats() const
+{
+    return SpaceStats{
+        .pageSize  = queryNumber("PRAGMA page_size;"),
+        .pages     = queryNumber("PRAGMA page_count;"),
+        .freePages = queryNumber("PRAGMA freelist_count;"),
+        .entries   = queryNumber("SELECT count(*) FROM Vault;")
+    };
+}
@@ -0,0 +1,11 @@
+#include "vault.ih"
+
+void Vault::store(Key const &key,
+                  string const &website, string const &userIdentifier,
+                  string_view password)
+{
+    SecureBytes const sealed = seal(key, website, userIdentifier, password);
+    auto const [websiteColumn, userColumn] = 
+                                columnNames(key, website, userIdentifier);
+    upsert(websiteColumn, userColumn, sealed);
+}
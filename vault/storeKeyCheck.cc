@@ -0,0 +1,21 @@
+#include "vault.ih"
+
+void Vault::storeKeyCheck()
+{                                      // nonce || tag of an empty message:
+    string check(KEY_CHECK_SIZE, '\0');// only the right key reproduces it
+    auto *nonce = reinterpret_cast<unsigned char *>(check.data());
+    randombytes_buf(nonce, crypto_aead_xchacha20poly1305_ietf_NPUBBYTES);
+
+    unsigned long long tagLength = 0;
+    crypto_aead_xchacha20poly1305_ietf_encrypt(
+        nonce + crypto_aead_xchacha20poly1305_ietf_NPUBBYTES, &tagLength,
+        /*m=*/nullptr, 0,
+        reinterpret_cast<unsigned char const *>(KEY_CHECK_AD), 
+        sizeof KEY_CHECK_AD - 1,
+        /*nsec=*/nullptr,
+        nonce,
+        d_key.data()
+    );
+
+    writeMeta("kcv", check);
+}
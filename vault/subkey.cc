@@ -0,0 +1,10 @@
+#include "vault.ih"
+
+Key Vault::subkey(Key const &key, uint64_t id) const
+{
+    Key sub;
+    crypto_kdf_derive_from_key(sub.data(), sub.size(), id, SUBKEY_CONTEXT,
+                               key.data());
+    sub.setValid(true);
+    return sub;
+}
@@ -13,11 +13,21 @@ void Vault::unlock()
     for (size_t attempts = 0; attempts != MAX_ATTEMPTS; ++attempts)
     {
         string password = IOTools::hiddenPrompt("Master password: ");
-                                       // Argon2 verify — returns 0 on success
-        if (verifyMaster(password))
+        cout << "Unlocking" << flush;  // a dot per 100 ms of Argon2
+        bool const unlocked = verifyMaster(password, [] 
+        {
+            cout << '.' << flush;
+        });
+        cout << '\n';
+
+        if (unlocked)
+        {
+            cout << "Vault unlocked.\n";
             return;
+        }
+        cout << "Incorrect password.\n";
     }
 
     wipeKey();
     throw runtime_error("Too many failed attempts — vault remains locked.");
-}
\ No newline at end of file
+}
@@ -0,0 +1,6 @@
+#include "vault.ih"
+
+bool Vault::unlock(string &master)
+{
+    return verifyMaster(master);
+}
@@ -0,0 +1,17 @@
+#include "vault.ih"
+                                       // static
+void Vault::unpack(span<uint8_t const> &nonce, span<uint8_t const> &tag,
+                   span<uint8_t const> &cipher)
+{
+    if (!nonce.empty() || !tag.empty())
+        return;                        // v1 row: stored apart already
+
+    size_t const nonceSize = crypto_aead_xchacha20poly1305_ietf_NPUBBYTES;
+    size_t const tagSize = crypto_aead_xchacha20poly1305_ietf_ABYTES;
+    if (cipher.size() < nonceSize + tagSize)
+        return;                        // left for decrypt to reject
+                                       // v2 row: nonce || cipher || tag
+    nonce  = cipher.first(nonceSize);
+    tag    = cipher.last(tagSize);
+    cipher = cipher.subspan(nonceSize, cipher.size() - nonceSize - tagSize);
+}
@@ -0,0 +1,23 @@
+#include "vault.ih"
+
+optional<Key> Vault::unwrapKey(string_view wrapped, Key const &kek)
+{
+    Key key;
+    size_t const nonceSize = crypto_aead_xchacha20poly1305_ietf_NPUBBYTES;
+    if (wrapped.size() != nonceSize + key.size() 
+                          + crypto_aead_xchacha20poly1305_ietf_ABYTES)
+        throw runtime_error("Malformed wrapped key in DB");
+
+    auto const *bytes = reinterpret_cast<unsigned char const *>(
+                                                            wrapped.data());
+    if (crypto_aead_xchacha20poly1305_ietf_decrypt(
+            key.data(), nullptr, /*nsec=*/nullptr,
+            bytes + nonceSize, wrapped.size() - nonceSize,
+            reinterpret_cast<unsigned char const *>(WRAP_AD), 
+            sizeof WRAP_AD - 1,
+            bytes, kek.data()) != 0)
+        return nullopt;                // a different KEK
+
+    key.setValid(true);
+    return key;
+}
@@ -0,0 +1,28 @@
+#include "vault.ih"
+
+void Vault::upsert(SecureBytes const &websiteColumn, 
+                   SecureBytes const &userColumn, SecureBytes const &sealed)
+{
+    char constexpr addValuesSql[] = 
+        "INSERT INTO Vault (Website, UserIdentifier, nonce, tag, ciphertext) "
+        "VALUES (?1, ?2, x'', x'', ?3) "
+        "ON CONFLICT(Website, UserIdentifier) DO UPDATE SET "
+        "  nonce=excluded.nonce, "
+        "  tag=excluded.tag, "
+        "  ciphertext=excluded.ciphertext;";
+
+    Statement statement = StageStats::time(StageStats::PREPARE, [&]
+                          {
+                              return d_db.prepare(addValuesSql);
+                          });
+                                       // the buffers outlive the statement's
+    bindName(statement.ptr, 1, websiteColumn);      // use: no copies
+    bindName(statement.ptr, 2, userColumn);
+    sqlite3_bind_blob (statement.ptr, 3, sealed.data(), sealed.size(), SQLITE_STATIC);
+
+    if (StageStats::time(StageStats::STEP, [&]
+                         {
+                             return sqlite3_step(statement.ptr);
+                         }) != SQLITE_DONE)
+        throw runtime_error("SQLite insert failed: " + string(sqlite3_errmsg(d_db)));
+}
@@ -2,36 +2,146 @@
 #define INCLUDED_VAULT_
 
 #include <array>
+#include <atomic>
 #include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 #include "../key/key.hh"
+#include "../breachIndex/breachIndex.hh"
+#include "../connectionPool/connectionPool.hh"
+#include "../credential/credential.hh"
 #include "../dbHandle/dbHandle.hh"
+#include "../durability/durability.hh"
+#include "../kdfParams/kdfParams.hh"
+#include "../passwordGenerator/passwordGenerator.hh"
 #include "../secret/secret.hh"
+#include "../secretCache/secretCache.hh"
+#include "../secureAllocator/secureAllocator.hh"
+#include "../spaceStats/spaceStats.hh"
+#include "../trigramIndex/trigramIndex.hh"
 
 /**
  * \brief Persistent secrets container backed by SQLite with AEAD encryption.
  *
  * This class is responsible for:
  * 
- *  - Creating and maintaining the SQLite schema (a `Vault` table for entries
- *    and a `meta` table for KDF salt + password verifier).
+ *  - Creating and maintaining the SQLite schema (a `Vault` table for entries,
+ *    clustered on (Website, UserIdentifier), and a `meta` table for KDF
+ *    salt, key check value and settings). `schema_version` in `meta` 
+ *    records the layout; older vaults are migrated when opened.
  * 
- *  - Deriving a per-session encryption key from the *master password* using
- *    libsodium's Argon2id (crypto_pwhash) and a stored random salt.
+ *  - Opening quickly: all meta rows are read by a single query when the
+ *    vault is opened and serve the reads of opening and unlocking it (the
+ *    first change to the meta table drops them); the schema is only 
+ *    checked if `schema_version` is not the current one. Unlocking runs
+ *    Argon2 on a worker thread while this one reads the entries' pages 
+ *    into the page cache, so the first command does not wait for the disk.
+ * 
+ *  - Applying the vault's durability profile (journal mode, synchronous 
+ *    level, mmap and cache sizes), stored in `meta`, on every open.
+ * 
+ *  - Envelope encryption: entries are encrypted under a random *data key*,
+ *    stored in `meta` (`dek`) wrapped by a key-encryption key (KEK) that
+ *    is derived from the *master password* using libsodium's Argon2id
+ *    (crypto_pwhash), a stored random salt and the vault's own Argon2 cost
+ *    parameters (`kdf_*` in `meta`). The password is authenticated by the
+ *    unwrapping, so an unlock costs a single Argon2 run, and changing the
+ *    password or the cost only rewraps the data key. A recovery key can
+ *    wrap the same data key (`dek_recovery`). Older vaults, whose entries
+ *    are encrypted under the derived key itself (authenticated by the
+ *    `kcv` AEAD tag, or by a separate pwhash verifier, which is migrated 
+ *    on the next unlock), get a data key when the password or cost is 
+ *    changed, or the key rotated.
  * 
  *  - Encrypting newly generated passwords with XChaCha20-Poly1305 (IETF) and
  *    authenticated associated data (AAD) set to `website + '\0' + userIdentifier`.
+ *    Entries are written in the v2 row format: `nonce || cipher || tag` in
+ *    the `ciphertext` column, `nonce` and `tag` left empty. Rows of the 
+ *    original format (all three apart) are still read, and are converted
+ *    whenever they are rewritten.
  * 
  *  - Decrypting stored entries after the vault is unlocked.
+ *
+ *  - Optionally (a *blinded* vault, `blinded` set in `meta`) keeping the
+ *    website and user names private as well: the `Website` column then
+ *    holds a BLAKE2b hash of `website + '\0' + userIdentifier`, keyed with a
+ *    subkey of the session key, and `UserIdentifier` the names sealed with
+ *    that hash as nonce. Both are deterministic, so `get` remains a single
+ *    probe of the unique index.
  * 
- *  - Zeroizing sensitive material in memory where feasible.
+ *  - Zeroizing sensitive material in memory where feasible. Keys, secrets
+ *    and the scratch buffers of `add` and `get` live in the `SecureArena`,
+ *    locked memory whose blocks are reused from one call to the next.
+ *
+ * A Vault is used from one thread, except after `enableConcurrentReads()`:
+ * from then on `get` may be called from any number of threads, and `add`
+ * and `addMany` are serialized internally. Readers use a pool of read-only
+ * WAL connections and an immutable copy of the session key, so they neither
+ * wait for each other nor for the writer. The remaining members must still
+ * not run concurrently with anything else.
  */
 class Vault
 {
-    DbHandle d_db;                     // RAII handle for the sqlite db connection
-    Key      d_key;                    // 32 bytes session key 
+    enum
+    {                                  // nonce || tag
+        KEY_CHECK_SIZE = crypto_aead_xchacha20poly1305_ietf_NPUBBYTES
+                         + crypto_aead_xchacha20poly1305_ietf_ABYTES,
+        LOCATOR_SIZE   = crypto_generichash_BYTES,
+
+        LOCATOR_KEY    = 1,            // subkey ids of a blinded vault
+        NAMES_KEY      = 2,
+
+        SCHEMA_VERSION = 2,            // 1: rowid table + unique index
+
+        RECOVERY_SIZE  = 32,           // random bytes of a recovery key
+
+        MAX_DRAWS      = 16,           // generated passwords tried per add
+
+        WARM_ROWS      = 256           // rows read between checks of warmUp
+    };
+                                       // key -> value of the meta table
+    using Meta = std::map<std::string, std::string, std::less<>>;
+                                       // AAD of the key check value
+    static constexpr char KEY_CHECK_AD[] = "cerberus key check v1";
+                                       // AAD of a key wrapped by another
+    static constexpr char WRAP_AD[] = "cerberus wrapped key v1";
+                                       // recovery keys: form and KEK
+    static constexpr char RECOVERY_PREFIX[] = "cerb-rk-";
+    static constexpr char RECOVERY_AD[] = "cerberus recovery key v1";
+                                       // crypto_kdf context of the subkeys
+    static constexpr char SUBKEY_CONTEXT[crypto_kdf_CONTEXTBYTES + 1] = 
+                                                                "cerbname";
+
+    DbHandle   d_db;                   // RAII handle for the sqlite db connection
+    Key        d_key;                  // 32 bytes session key 
+    Durability d_durability;           // PRAGMAs applied on open
+    KdfParams  d_kdf;                  // Argon2 cost of this vault
+    bool       d_blinded = false;      // names stored encrypted
+                                       // meta rows read at open, until the
+    std::optional<Meta> d_meta;        // unlock or the first change
+                                       // concurrent mode only:
+    std::unique_ptr<ConnectionPool> d_readers;
+    std::atomic<std::shared_ptr<Key const>> d_sharedKey;  // null: locked
+    std::mutex d_writeMutex;           // one add/addMany at a time
+                                       // decrypted secrets, if enabled
+    std::unique_ptr<SecretCache> d_cache;
+                                       // names for list/search, built on
+    mutable std::mutex d_namesMutex;   // first use after unlocking
+    mutable std::unique_ptr<TrigramIndex> d_names;
+                                       // breached passwords, if set,
+    mutable std::mutex d_breachMutex;  // opened on first use
+    mutable std::function<std::shared_ptr<BreachIndex const>()> 
+                                                            d_openBreaches;
+    mutable std::shared_ptr<BreachIndex const> d_breaches;
 
     public:
         Vault(std::string const &filename = "vault.db");
@@ -44,53 +154,580 @@ class Vault
 
         ~Vault() = default;
         
-        /** Return the password verifier (if any) from the meta table.*/
+        /** Return the legacy password verifier (if any) from the meta 
+         *  table.*/
         std::optional<std::string> getVerifier() const;
 
-        /** True if the vault has been initialized (`verifier` present).*/                                      
+        /** True if the vault has been initialized (key check value or 
+         *  legacy verifier present).*/                                      
         bool isInitialized() const;    
 
-        /** First-time setup: prompt for master password, store verifier, 
-         *  derive session key.*/
+        /** First-time setup: prompt for master password and KDF cost,
+         *  derive session key, store key check value.*/
         void setup();
 
-        /** Prompt for master password (up to MAX_ATTEMPTS) and derive session key.*/
+        /** Non-interactive setup with the given master password, which is
+         *  wiped afterwards, and Argon2 cost.*/
+        void initialize(std::string &master, 
+                        KdfParams const &params = KdfParams{});
+
+        /** Prompt for master password (up to MAX_ATTEMPTS) and derive 
+         *  session key, showing progress while Argon2 runs.*/
         void unlock();
 
+        /** Non-interactive unlock; `master` is wiped. Returns false if the
+         *  password is wrong.*/
+        bool unlock(std::string &master);
+
+        /** Wipe the session key; `add` and `get` fail until the next
+         *  unlock.*/
+        void lock();
+
+        /**
+         * Switch to new Argon2 cost parameters (and a new salt). `master`
+         * must be the current master password; it is wiped. Only the 
+         * wrapped data key is rewritten, except in a vault without a data
+         * key: there every entry is re-encrypted under a new one, all in
+         * one transaction.
+         * \returns the number of re-encrypted entries.
+         * \throws std::runtime_error if the vault is locked, the password is
+         *         wrong, or on DB/crypto error.
+         */
+        size_t changeKdf(std::string &master, KdfParams const &params);
+
+        /**
+         * Change the master password: `current` (the master password or a
+         * recovery key) authorizes, `next` becomes the new password; both
+         * are wiped. The data key is rewrapped under the new password's KEK
+         * (with a new salt), so the cost does not depend on the number of
+         * entries, except once for a vault without a data key.
+         * \returns the number of re-encrypted entries.
+         * \throws std::runtime_error if the vault is locked, `current` is
+         *         wrong, or on DB/crypto error.
+         */
+        size_t changeMaster(std::string &current, std::string &next);
+
+        /**
+         * Create a recovery key, which unlocks the vault (and may then set
+         * a new master password) like the master password does. `master` is
+         * wiped. The key is returned once, and not stored: only the data 
+         * key wrapped under it is. A new recovery key replaces the previous
+         * one; rotating the data key revokes it.
+         * \throws std::runtime_error if the vault is locked, the password is
+         *         wrong, or on DB/crypto error.
+         */
+        Secret createRecoveryKey(std::string &master);
+
+        /**
+         * Replace the data key by a random one and re-encrypt every entry
+         * under it; `master` (the current master password; it is wiped)
+         * wraps the new key, and a recovery key is revoked. Entries flow 
+         * through a pipeline: batches of `batchSize` are read, decrypted and
+         * re-encrypted on `threads` threads (0: hardware concurrency) and
+         * written back in one transaction per batch, which also records the
+         * progress in the meta table. An interrupted rotation is finished by
+         * the next unlock, or by calling this again, without starting over.
+         * `progress`, if set, gets (entries done, total) after every batch.
+         * Other threads must not use the vault meanwhile.
+         * \returns the number of re-encrypted entries.
+         * \throws std::runtime_error if the vault is locked, the password is
+         *         wrong, or on DB/crypto error.
+         */
+        size_t rotateKey(std::string &master, size_t batchSize = 1024,
+                         size_t threads = 0,
+                         std::function<void(size_t, size_t)> const &progress
+                                                                    = {});
+
+        /**
+         * Make `get` callable from many threads at once, using up to 
+         * `readers` pooled read-only connections (0: hardware concurrency).
+         * Switches the vault to WAL journaling if it is not using it yet.
+         * \throws std::runtime_error on DB error.
+         */
+        void enableConcurrentReads(size_t readers = 0);
+
+        /**
+         * Keep up to `capacity` secrets returned by `get` in a locked-memory
+         * LRU cache, each for at most `ttl`. `add` and `addMany` invalidate
+         * the entries they replace; locking the vault wipes the cache.
+         */
+        void enableCache(size_t capacity, std::chrono::seconds ttl);
+
+        /** Hit/miss counters of the cache (all 0 if it is not enabled).*/
+        SecretCache::Stats cacheStats() const;
+
+        /**
+         * Check generated passwords against the breach corpus `breaches`
+         * (null: stop checking): `add` draws another password while the
+         * generated one is in it.
+         */
+        void setBreachIndex(std::shared_ptr<BreachIndex const> breaches);
+
+        /**
+         * As the above, but the corpus is only opened, by calling `open`,
+         * when the first `add` or `audit` needs it: reading a large corpus
+         * takes a while, which a session that does neither does not pay.
+         * `open` is called once; if it returns null nothing is checked.
+         */
+        void setBreachIndex(
+                std::function<std::shared_ptr<BreachIndex const>()> open);
+
+        /**
+         * The (website, userIdentifier) pairs, in `forEach` order, of the 
+         * entries whose password is in the breach corpus set by 
+         * `setBreachIndex`. The entries are decrypted in parallel batches;
+         * the corpus is mostly answered by its in-memory filter.
+         * \throws std::runtime_error if no corpus is set, if the vault is
+         *         locked, or as `forEach`.
+         */
+        std::vector<std::pair<std::string, std::string>> audit() const;
+
+        /** True if website and user names are stored encrypted.*/
+        bool blinded() const;
+
+        /**
+         * Convert the vault to (`blinded` true) or from the blinded format,
+         * rewriting every entry in one transaction.
+         * \returns the number of converted entries (0 if already in that
+         *          format).
+         * \throws std::runtime_error if the vault is locked or on DB/crypto
+         *         error.
+         */
+        size_t setBlinded(bool blinded);
+
+        /**
+         * Write an encrypted backup of the vault to the file `archive` 
+         * while it stays in use. The database is copied with SQLite's 
+         * backup API, `pagesPerStep` pages at a time, into a scratch file
+         * (`archive` + ".part", owner-only), which is then streamed into 
+         * the archive, encrypted under `password` (wiped) at the vault's
+         * Argon2 cost; see `Archive`. Between steps the writer connection is
+         * released, so `add` and `get` wait for at most one step; changes 
+         * by other connections restart the copy. `progress`, if set, gets
+         * (pages copied, total pages) after every step.
+         * \returns the number of pages backed up.
+         * \throws std::runtime_error if `archive` or the scratch file
+         *         exists (neither is overwritten), or on DB or I/O error;
+         *         the scratch file and a partial archive are removed.
+         */
+        size_t backup(std::string const &archive, std::string &password,
+                      size_t pagesPerStep = 64,
+                      std::function<void(size_t, size_t)> const &progress 
+                                                                    = {});
+
+        /**
+         * Restore the backup `archive`, encrypted under `password` (wiped),
+         * as the new vault file `filename`. The database is decrypted into
+         * `filename` + ".part" and only linked to `filename` once it has
+         * been fully authenticated and passes SQLite's quick check; the 
+         * link fails rather than replace a file created meanwhile.
+         * \returns the size of the restored file.
+         * \throws std::runtime_error if `filename` exists, the password is
+         *         wrong, the archive is corrupt, or on I/O error.
+         */
+        static size_t restore(std::string const &archive, 
+                              std::string const &filename, 
+                              std::string &password);
+
+        /**
+         * Write every entry to the read-only snapshot file `filename` (see
+         * `SnapshotVault`), re-encrypted under a new random snapshot key 
+         * that is wrapped by the KEK of `master` (the current master 
+         * password; it is wiped), so the snapshot opens with the same 
+         * password. The file is written as `filename` + ".part" and linked
+         * to `filename` when complete; an existing file is never replaced.
+         * \returns the number of entries.
+         * \throws std::runtime_error if the vault is locked, `filename` 
+         *         exists, the password is wrong, or on DB/I/O error.
+         */
+        size_t exportSnapshot(std::string const &filename, 
+                              std::string &master);
+
+        /** Page, free-page and per-entry space use of the vault file.*/
+        SpaceStats spaceStats() const;
+
+        /**
+         * Return free pages to the file system (incremental vacuum, or a
+         * full VACUUM for files without incremental auto-vacuum), truncate 
+         * the WAL and refresh the query planner statistics.
+         * \returns the space use afterwards.
+         * \throws std::runtime_error on DB error.
+         */
+        SpaceStats compact();
+
+        /** The Argon2 cost parameters of this vault.*/
+        KdfParams const &kdfParams() const;
+
+        /** The durability profile in effect.*/
+        Durability const &durability() const;
+
+        /**
+         * Apply `profile` and, once it took effect, store it in the meta
+         * table. A changed page size rebuilds the database file (VACUUM). On
+         * failure the stored profile is unchanged and applied again.
+         * \throws std::invalid_argument for an invalid profile,
+         *         std::runtime_error on DB error.
+         */
+        void setDurability(Durability const &profile);
+
         /**
          * Insert or replace an entry for (website, userIdentifier).
-         * Generates a random password of `length`, encrypts it using the current
-         * session key and returns it wrapped in `Secret`.
-         * \throws std::runtime_error if the vault is locked or on DB/crypto error.
+         * Generates a random password following `policy`, encrypts it using 
+         * the current session key and returns it wrapped in `Secret`.
+         * \throws std::invalid_argument for an invalid policy,
+         *         std::runtime_error if the vault is locked or on DB/crypto
+         *         error.
+         */
+        Secret add(std::string const &website, 
+                   std::string const &userIdentifier,
+                   PasswordGenerator::Policy const &policy);
+
+        /**
+         * As above, with a password of `length` characters containing every
+         * character class.
+         * \throws std::invalid_argument if `length < 4`.
          */
         Secret add(std::string const &website, 
                    std::string const &userIdentifier, size_t length);
 
+        /**
+         * As above, with a password generated by the compile-time 
+         * `PasswordPolicy` type `Policy`, e.g. `vault.add<DefaultPolicy>(...)`.
+         * Every generated password is checked with `Policy::satisfies`.
+         * \throws std::logic_error if one fails that check.
+         */
+        template <typename Policy>
+        Secret add(std::string const &website, 
+                   std::string const &userIdentifier);
+
+        /**
+         * Insert or replace all `credentials`, keeping their passwords.
+         * Rows are written in transactions of `chunkSize` entries (0: one
+         * transaction for the whole batch), so a batch costs one journal
+         * sync per chunk rather than one per row. A failing chunk is rolled
+         * back; earlier chunks stay committed.
+         * \returns the number of entries stored.
+         * \throws std::runtime_error if the vault is locked or on DB error.
+         */
+        size_t addMany(std::vector<Credential> const &credentials,
+                       size_t chunkSize = 0);
+
+        /**
+         * As above, for the credentials `next` returns until it returns
+         * nullopt, e.g. records streamed from an import file: only the
+         * names of one chunk are held at a time. An exception from `next`
+         * rolls the current chunk back.
+         */
+        size_t addMany(
+                std::function<std::optional<Credential>()> const &next,
+                size_t chunkSize = 0);
+
         /**
          * Retrieve and decrypt the password for (website, userIdentifier).
          * \throws std::runtime_error if the vault is locked, record is missing,
          *         or authentication fails.
          */
-        std::string get(std::string const &website, 
-                        std::string const &userIdentifier) const;
+        Secret get(std::string const &website, 
+                   std::string const &userIdentifier) const;
+
+        /**
+         * As `get`, but nullopt if there is no entry for (website, 
+         * userIdentifier).
+         * \throws std::runtime_error if the vault is locked, on DB error
+         *         or if authentication fails.
+         */
+        std::optional<Secret> find(std::string const &website, 
+                                   std::string const &userIdentifier) const;
+
+        /**
+         * Decrypt the password for (website, userIdentifier) from SQLite's
+         * column memory straight into `out`, bypassing the cache.
+         * \returns the length of the password.
+         * \throws std::runtime_error as `get`, or if `out` is too small.
+         */
+        size_t get(std::string const &website, 
+                   std::string const &userIdentifier, 
+                   std::span<char> out) const;
+
+        /**
+         * Stream every entry, decrypted, to `sink` in (website, user) order
+         * (in a blinded vault: in the order of their hashes).
+         * Rows are read in batches of `batchSize`; the AEAD decryptions of a
+         * batch are spread over `threads` threads (0: hardware concurrency),
+         * while `sink` is only called from the calling thread. Memory use is
+         * bounded by one batch, whatever the size of the vault. `sink` must
+         * not modify the vault.
+         * \throws std::runtime_error if the vault is locked, on DB error, or
+         *         if an entry fails to authenticate.
+         */
+        void forEach(std::function<void(Credential const &)> const &sink,
+                     size_t batchSize = 1024, size_t threads = 0) const;
+
+        /**
+         * Every (website, userIdentifier) pair of the vault, sorted.
+         * \throws std::runtime_error if the vault is locked or on DB error.
+         */
+        std::vector<std::pair<std::string, std::string>> list() const;
+
+        /**
+         * The at most `limit` (0: all) entries whose website or user 
+         * best match `fragment`: substring matches, case-insensitive, then
+         * fuzzy ones (see `TrigramIndex`), best first. The names are
+         * indexed in memory by the first `list` or `search` after an 
+         * unlock and kept up to date by `add` and `addMany`, so a search
+         * does not scan the table; locking the vault drops the index.
+         * \throws std::runtime_error if the vault is locked or on DB error.
+         */
+        std::vector<TrigramIndex::Match> search(std::string_view fragment,
+                                                size_t limit = 20) const;
+
+        /** Create the empty file `filename`, readable by the owner only,
+         *  for secrets written from outside the vault (e.g. an export).
+         *  \throws std::runtime_error if it exists or cannot be created.*/
+        static void createPrivate(std::string const &filename);
 
     private:
+        /** Authenticate and decrypt one stored entry with `key`; the AAD is
+         *  `website + '\0' + userIdentifier`.
+         *  \throws std::runtime_error on malformed or forged input.*/
+        Secret decrypt(Key const &key, std::string const &website,
+                       std::string const &userIdentifier,
+                       std::span<std::uint8_t const> nonce,
+                       std::span<std::uint8_t const> tag,
+                       std::span<std::uint8_t const> cipher) const;
+
+        /** As above, into `out`; returns the plaintext size.
+         *  \throws std::runtime_error also if `out` is too small.*/
+        size_t decrypt(Key const &key, std::string const &website,
+                       std::string const &userIdentifier,
+                       std::span<std::uint8_t const> nonce,
+                       std::span<std::uint8_t const> tag,
+                       std::span<std::uint8_t const> cipher,
+                       std::span<char> out) const;
+
+        /** The blob in column `col` of the current row of `row`.*/
+        static std::span<std::uint8_t const> columnBlob(Statement const &row,
+                                                        int col);
+
+        /** Bind a `Website` / `UserIdentifier` column value: text, or a 
+         *  blob in a blinded vault. With SQLITE_STATIC the caller keeps
+         *  `value` alive as long as the statement; a statement outliving
+         *  it needs SQLITE_TRANSIENT (SQLite's own copy).*/
+        void bindName(sqlite3_stmt *statement, int idx, 
+                      SecureBytes const &value,
+                      sqlite3_destructor_type lifetime = SQLITE_STATIC) const;
+
+        /** The `Website` and `UserIdentifier` column values of the entry
+         *  (website, userIdentifier): the names themselves or, blinded,
+         *  their keyed hash and sealed names.*/
+        std::pair<SecureBytes, SecureBytes> columnNames(Key const &key,
+                                    std::string const &website,
+                                    std::string const &userIdentifier) const;
+
+        /** Fetch and decrypt an entry through `db`, nullopt if there is
+         *  none; `key` null or invalid means locked.*/
+        std::optional<Secret> fetch(DbHandle const &db, Key const *key,
+                                    std::string const &website,
+                                    std::string const &userIdentifier) const;
+
+        /** As above, decrypting into `out`; returns the password's size.
+         *  \throws std::runtime_error if there is no entry.*/
+        size_t fetch(DbHandle const &db, Key const *key,
+                     std::string const &website,
+                     std::string const &userIdentifier,
+                     std::span<char> out) const;
+
         /** Derive a 32-byte session key with Argon2id from the provided 
          *  master password.*/
         void deriveSessionKey(std::string &master);
 
-        /** Ensure the required tables exist.*/
+        /** The Argon2id KEK of `master` under the vault's salt and cost, 
+         *  derived on a worker thread while this one runs `warmUp`;
+         *  `waiting`, if set, is called about every 100 ms until then.*/
+        Key deriveOverlapped(std::string const &master,
+                             std::function<void()> const &waiting);
+
+        /** Read the pages of the entries table into the page cache, until
+         *  they are all read or `stop` returns true (checked every 
+         *  WARM_ROWS rows).*/
+        void warmUp(std::function<bool()> const &stop) const;
+
+        /** The breach corpus, opened if this is its first use; null if
+         *  none is set.*/
+        std::shared_ptr<BreachIndex const> breaches() const;
+
+        /** The name index, read from the table if it is not built yet;
+         *  the caller holds `d_namesMutex`.*/
+        TrigramIndex const &names() const;
+
+        /** Add (website, userIdentifier) to the name index, if built.*/
+        void indexNames(std::string_view website, 
+                        std::string_view userIdentifier);
+
+        /** Bring the name index and the cache up to date with the 
+         *  committed entry (website, userIdentifier).*/
+        void committed(std::string const &website, 
+                       std::string const &userIdentifier);
+
+        /** Ensure the required tables exist, in the current layout.*/
         void ensureSchema();
 
+        /** Move the entries of a rowid-table vault to the clustered table,
+         *  then switch the file to incremental auto-vacuum.*/
+        void migrateSchema();
+
+        /** The first column of the single row returned by `sql`.*/
+        long long queryNumber(std::string_view sql) const;
+
+        /** Read the durability profile from the meta table; absent keys
+         *  keep their defaults.*/
+        Durability loadDurability() const;
+
+        /** True if the session key opens the key check value `check`.*/
+        bool keyMatches(std::string const &check) const;
+
+        /** Recover (website, userIdentifier) from blinded column values.
+         *  \throws std::runtime_error on malformed or forged input.*/
+        std::pair<std::string, std::string> openNames(Key const &key,
+                                    std::string const &locator,
+                                    std::string const &sealed) const;
+
+        /** `website + '\0' + userIdentifier` in secure memory: the AAD
+         *  of an entry and its name in the cache.*/
+        static SecureBytes joinNames(std::string_view website, 
+                                     std::string_view userIdentifier);
+
+        /** Step `db`'s lookup statement onto the row of the entry 
+         *  (website, userIdentifier), nullopt if there is none; `key` null
+         *  or invalid means locked.
+         *  \throws std::runtime_error if locked or on DB error (busy,
+         *         I/O, corruption).*/
+        std::optional<Statement> locate(DbHandle const &db, Key const *key,
+                                        std::string const &website,
+                                        std::string const &userIdentifier) 
+                                                                    const;
+
+        /** The error of a lookup of a missing entry.*/
+        static std::runtime_error missing(std::string const &website,
+                                          std::string const &userIdentifier);
+
+        /** Read the Argon2 cost from the meta table (MODERATE if absent).*/
+        KdfParams loadKdfParams() const;
+
         /** Load the stored Argon2 salt or create and persist a new one. */
         std::vector<std::uint8_t> loadOrCreateSalt();
 
-        /** Verify the provided master password against the stored verifier;
-         *  derive session key on success.*/
-        bool verifyMaster(std::string &password);
+        /** All rows of the meta table, in one query; nullopt if the vault
+         *  has no meta table yet.*/
+        std::optional<Meta> loadMeta() const;
+
+        /** Value stored under `key` in the meta table, if any (from 
+         *  `d_meta` while it is loaded).*/
+        std::optional<std::string> readMeta(std::string_view key) const;
+
+        /** Insert or replace the meta value stored under `key`. Like every
+         *  change to the meta table, drops `d_meta`.*/
+        void writeMeta(std::string_view key, std::string_view value);
+
+        /** Store the Argon2 cost parameters in the meta table.*/
+        void writeKdfParams(KdfParams const &params);
+
+        /** In concurrent mode, hand readers a copy of the (new) session 
+         *  key, or none if the vault is locked.*/
+        void publishKey();
+
+        /** Re-encrypt every entry from the session key to `next`, in the
+         *  (un)blinded format `blinded`, which becomes the vault's; the 
+         *  caller provides the transaction.*/
+        size_t rewrite(Key const &next, bool blinded);
+
+        /** The KEK of `master`; throws (and wipes `master`) unless it
+         *  unwraps (or, in older vaults, is) the session key.*/
+        Key checkMaster(std::string &master);
+
+        /** Argon2id KEK of `master`.*/
+        static Key deriveKek(std::string const &master, 
+                             std::span<std::uint8_t const> salt,
+                             KdfParams const &params);
+
+        /** The KEK of `credential` if it has the form of a recovery key.*/
+        static std::optional<Key> recoveryKek(std::string_view credential);
+
+        /** A fresh random data key.*/
+        static Key randomKey();
+
+        /** In one transaction: re-encrypt every entry under `next`, if 
+         *  given, making it the session key; then store `salt`, `params` 
+         *  and the session key wrapped under `kek`.*/
+        size_t installKey(std::optional<Key> next, Key const &kek,
+                          std::span<std::uint8_t const> salt,
+                          KdfParams const &params);
+
+        /** Run the rotation planned in the meta table and the 
+         *  RotationQueue table to its end; see `rotateKey`.*/
+        size_t continueRotation(size_t batchSize = 1024, size_t threads = 0,
+                                std::function<void(size_t, size_t)> const 
+                                                            &progress = {});
+
+        /** Store a fresh key check value for the current session key.*/
+        void storeKeyCheck();
+
+        /** Encrypt `password` under `key` and upsert it as the entry for
+         *  (website, userIdentifier).*/
+        void store(Key const &key, std::string const &website,
+                   std::string const &userIdentifier,
+                   std::string_view password);
+
+        /** Store a password from `generate` for (website, 
+         *  userIdentifier), drawing again (up to MAX_DRAWS times) while it
+         *  is in the breach corpus, drop its cached predecessor and hand
+         *  the password back.*/
+        Secret insert(std::string const &website,
+                      std::string const &userIdentifier, 
+                      std::function<Secret()> const &generate);
+
+        /** `password` as a v2 blob (nonce || cipher || tag) under `key`.*/
+        SecureBytes seal(Key const &key, std::string const &website,
+                         std::string const &userIdentifier,
+                         std::string_view password) const;
+
+        /** Insert or replace the row with the given name columns.*/
+        void upsert(SecureBytes const &websiteColumn, 
+                    SecureBytes const &userColumn, SecureBytes const &sealed);
+
+        /** `key` sealed under `kek` (nonce || cipher || tag).*/
+        static std::string wrapKey(Key const &key, Key const &kek);
+
+        /** The key sealed by `wrapKey`; nullopt if `kek` is not the one
+         *  that sealed it.
+         *  \throws std::runtime_error if `wrapped` is malformed.*/
+        static std::optional<Key> unwrapKey(std::string_view wrapped, 
+                                            Key const &kek);
+
+        /** Derive the session key from `password` and check it against the
+         *  key check value (or, for older vaults, verify `password` against
+         *  the pwhash verifier and then migrate); false if it is wrong.
+         *  `waiting` is passed to `deriveOverlapped`.*/
+        bool verifyMaster(std::string &password, 
+                          std::function<void()> const &waiting = {});
+
+        /** Subkey `id` of `key`, for the blinded format.*/
+        Key subkey(Key const &key, std::uint64_t id) const;
+
+        /** Point `nonce`, `tag` and `cipher` at the parts of a v2 row's
+         *  single blob; v1 rows are left as they are.*/
+        static void unpack(std::span<std::uint8_t const> &nonce,
+                           std::span<std::uint8_t const> &tag,
+                           std::span<std::uint8_t const> &cipher);
+
+
+        /** The statement creating the entries table `name`.*/
+        static std::string vaultTableSql(std::string_view name);
 
         /** Zeroize session key and mark it invalid.*/
         void wipeKey();
 };
 
+#include "add.i"
+
 #endif
\ No newline at end of file
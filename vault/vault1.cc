@@ -2,7 +2,20 @@
 
 Vault::Vault(string const &filename)
 :
-    d_db(filename)
-{          
-    ensureSchema();
-}
\ No newline at end of file
+    d_db(filename),
+    d_meta(loadMeta())                 // one query for all stored settings
+{                                      // a current vault needs no schema
+    if (!d_meta ||                     // work at all
+        !d_meta->contains("schema_version") ||
+        d_meta->at("schema_version") != to_string(SCHEMA_VERSION))
+    {
+        ensureSchema();
+        d_meta = loadMeta();
+    }
+                                       // PRAGMAs are per connection: apply
+    d_durability = loadDurability();   // the stored profile on every open
+    d_durability.apply(d_db);
+
+    d_kdf = loadKdfParams();
+    d_blinded = readMeta("blinded").value_or("0") == "1";
+}
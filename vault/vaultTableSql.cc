@@ -0,0 +1,15 @@
+#include "vault.ih"
+                                       // static
+string Vault::vaultTableSql(string_view name)
+{                                      // clustered on (Website, 
+    return                             // UserIdentifier): the key is stored
+        "CREATE TABLE IF NOT EXISTS "  // once, in the table's own B-tree
+        + string(name) + " (\n"
+        "    Website        varchar(255) NOT NULL,\n"
+        "    UserIdentifier varchar(255) NOT NULL,\n"
+        "    nonce          blob NOT NULL,\n"
+        "    tag            blob NOT NULL,\n"
+        "    ciphertext     blob NOT NULL,\n"
+        "    PRIMARY KEY (Website, UserIdentifier)\n"
+        ") WITHOUT ROWID;";
+}
@@ -1,20 +1,68 @@
 #include "vault.ih"
 
-bool Vault::verifyMaster(string &password)
+bool Vault::verifyMaster(string &password, function<void()> const &waiting)
 {
-    auto verifier = getVerifier();
+    if (optional<string> const wrapped = readMeta("dek"))
+    {                                  // the KEK of the password, or of a
+                                       // recovery key, unwraps the data key
+        optional<string> const recovery = readMeta("dek_recovery");
+        optional<Key> kek = recovery ? recoveryKek(password) : nullopt;
+        string const &sealed = kek ? *recovery : *wrapped;
+        if (!kek)
+            kek = deriveOverlapped(password, waiting);
+        sodium_memzero(password.data(), password.size());
+
+        optional<Key> key = unwrapKey(sealed, *kek);
+        if (!key)
+        {
+            wipeKey();
+            return false;
+        }
+        d_key = move(*key);
+        publishKey();
+        d_meta.reset();                // from now on, read the table
+        if (readMeta("rotate_key"))    // an interrupted rotation: entries
+            continueRotation();        // are under two keys until it ends
+        return true;
+    }
+
+    if (optional<string> const check = readMeta("kcv"))
+    {                                  // older vault, the KEK is the key:
+                                       // one Argon2 run both derives the key
+        d_key = deriveOverlapped(password, waiting);   // and, via the key
+        sodium_memzero(password.data(), password.size());   // check value,
+        if (keyMatches(*check))        // authenticates the password
+        {
+            publishKey();
+            d_meta.reset();
+            if (readMeta("rotate_key"))// an interrupted rotation: entries
+                continueRotation();    // are under two keys until it ends
+            return true;
+        }
+
+        wipeKey();
+        return false;
+    }
+
+    auto verifier = getVerifier();     // older vault: pwhash verifier
     if (!verifier)
         return false;
 
     if (crypto_pwhash_str_verify(verifier->c_str(),
-                                 password.c_str(), password.size()) == 0)
+                                 password.c_str(), password.size()) != 0)
     {
-        deriveSessionKey(password);
-        cout << "Vault unlocked.\n";
-        return true;                                 
+        sodium_memzero(password.data(), password.size());
+        return false;
     }
 
-    sodium_memzero(password.data(), password.size());
-    cout << "Incorrect password.\n";
-    return false;
-}
\ No newline at end of file
+    deriveSessionKey(password);
+                                       // migrate: from now on a single KDF
+    Transaction transaction(d_db);     // run unlocks the vault
+    storeKeyCheck();
+    d_meta.reset();
+    d_db.exec("DELETE FROM meta WHERE key='verifier';");
+    transaction.commit();
+
+    publishKey();
+    return true;                                 
+}
@@ -0,0 +1,15 @@
+#include "vault.ih"
+
+void Vault::warmUp(function<bool()> const &stop) const
+{                                      // stepping row by row visits every
+    Statement statement =              // leaf page of the clustered table
+        d_db.prepare("SELECT length(ciphertext) FROM Vault;");
+                                       // (count(*) is one uninterruptible
+    for (size_t rows = 0; ; ++rows)    // opcode)
+    {
+        if (rows % WARM_ROWS == 0 && stop())
+            return;
+        if (sqlite3_step(statement.ptr) != SQLITE_ROW)
+            return;                    // done, or failed: this is a hint
+    }
+}
@@ -4,4 +4,11 @@ void Vault::wipeKey()
 {
     sodium_memzero(d_key.data(), d_key.size());
     d_key.setValid(false);
+    publishKey();
+
+    if (d_cache)
+        d_cache->clear();
+                                       // a blinded vault's names are
+    lock_guard lock(d_namesMutex);
+    d_names.reset();                   // secret too
 }
\ No newline at end of file
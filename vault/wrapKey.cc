@@ -0,0 +1,16 @@
+#include "vault.ih"
+
+string Vault::wrapKey(Key const &key, Key const &kek)
+{                                      // nonce || cipher || tag
+    size_t const nonceSize = crypto_aead_xchacha20poly1305_ietf_NPUBBYTES;
+    string wrapped(nonceSize + key.size() 
+                   + crypto_aead_xchacha20poly1305_ietf_ABYTES, '\0');
+    auto *bytes = reinterpret_cast<unsigned char *>(wrapped.data());
+    randombytes_buf(bytes, nonceSize);
+
+    crypto_aead_xchacha20poly1305_ietf_encrypt(
+        bytes + nonceSize, nullptr, key.data(), key.size(),
+        reinterpret_cast<unsigned char const *>(WRAP_AD), sizeof WRAP_AD - 1,
+        /*nsec=*/nullptr, bytes, kek.data());
+    return wrapped;
+}
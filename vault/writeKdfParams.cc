@@ -0,0 +1,7 @@
+#include "vault.ih"
+
+void Vault::writeKdfParams(KdfParams const &params)
+{
+    writeMeta("kdf_opslimit", to_string(params.opsLimit));
+    writeMeta("kdf_memlimit", to_string(params.memLimit));
+}
@@ -0,0 +1,19 @@
+#include "vault.ih"
+
+void Vault::writeMeta(string_view key, string_view value)
+{
+    d_meta.reset();                    // even if the transaction is rolled
+                                       // back: read from the table again
+    char constexpr writeMetaSql[] = 
+        "INSERT INTO meta (key, value) VALUES (?1, ?2) "
+        "ON CONFLICT(key) DO UPDATE SET value=excluded.value;";
+
+    Statement statement = d_db.prepare(writeMetaSql);
+    sqlite3_bind_text(statement.ptr, 1, key.data(), key.size(), SQLITE_STATIC);
+    sqlite3_bind_blob(statement.ptr, 2, value.data(), value.size(), 
+                      SQLITE_STATIC);
+
+    if (sqlite3_step(statement.ptr) != SQLITE_DONE)
+        throw runtime_error("Storing " + string(key) + " failed: " 
+                            + string(sqlite3_errmsg(d_db)));
+}
@@ -0,0 +1,11 @@
+#include "workerPool.ih"
+
+WorkerPool::~WorkerPool()
+{
+    {
+        lock_guard lock(d_mutex);
+        d_stop = true;
+    }
+    d_wake.notify_all();
+    d_threads.clear();                 // joins
+}
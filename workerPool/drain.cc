@@ -0,0 +1,18 @@
+#include "workerPool.ih"
+
+void WorkerPool::drain()
+{
+    for (size_t idx; (idx = d_next.fetch_add(1)) < d_count; )
+    {
+        try
+        {
+            (*d_task)(idx);
+        }
+        catch (...)
+        {
+            lock_guard lock(d_mutex);
+            if (!d_error)
+                d_error = current_exception();
+        }
+    }
+}
@@ -0,0 +1,27 @@
+#include "workerPool.ih"
+
+void WorkerPool::run(size_t count, function<void(size_t)> const &task)
+{
+    if (count == 0)
+        return;
+
+    {
+        lock_guard lock(d_mutex);
+        d_task = &task;
+        d_count = count;
+        d_next = 0;
+        d_finished = 0;
+        d_error = nullptr;
+        ++d_generation;
+    }
+    d_wake.notify_all();
+
+    drain();                           // the caller works along
+
+    unique_lock lock(d_mutex);
+    d_done.wait(lock, [&]{ return d_finished == d_size - 1; });
+    d_task = nullptr;
+
+    if (d_error)
+        rethrow_exception(exchange(d_error, nullptr));
+}
@@ -0,0 +1,6 @@
+#include "workerPool.ih"
+
+size_t WorkerPool::size() const
+{
+    return d_size;
+}
@@ -0,0 +1,21 @@
+#include "workerPool.ih"
+
+void WorkerPool::work()
+{
+    for (size_t seen = 0; ; )
+    {
+        {
+            unique_lock lock(d_mutex);
+            d_wake.wait(lock, [&]{ return d_stop || d_generation != seen; });
+            if (d_stop)
+                return;
+            seen = d_generation;
+        }
+
+        drain();
+
+        lock_guard lock(d_mutex);      // every worker reports back, so no
+        if (++d_finished == d_size - 1)// worker is still inside a job 
+            d_done.notify_one();       // once run() has returned
+    }
+}
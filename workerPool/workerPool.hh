@@ -0,0 +1,67 @@
+#ifndef INCLUDED_WORKERPOOL_
+#define INCLUDED_WORKERPOOL_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * \brief Fixed set of threads executing parallel-for style jobs.
+ *
+ * `run(count, task)` calls `task(idx)` for every idx in [0, count), spreading
+ * the indices over the pool's threads and the calling thread, and returns
+ * once all of them have been processed. The threads persist between jobs, so
+ * a job costs a wake-up rather than a thread start. Jobs must not be 
+ * submitted concurrently from several threads.
+ */
+class WorkerPool
+{
+    size_t d_size;                     // parallelism, including the caller
+    std::vector<std::jthread> d_threads;
+
+    std::mutex d_mutex;
+    std::condition_variable d_wake;    // workers: a new job was posted
+    std::condition_variable d_done;    // caller: all workers finished it
+
+    std::function<void(size_t)> const *d_task = nullptr;
+    size_t d_count = 0;                // indices in the current job
+    std::atomic<size_t> d_next = 0;    // next index to hand out
+    size_t d_generation = 0;           // bumped for every job
+    size_t d_finished = 0;             // workers done with the current job
+    bool d_stop = false;
+    std::exception_ptr d_error;        // first exception thrown by a task
+
+    public:
+        /** A pool running jobs on `threads` threads in total (the caller
+         *  included); 0 selects the hardware concurrency. */
+        explicit WorkerPool(size_t threads = 0);
+
+        WorkerPool(WorkerPool const &other) = delete;
+        WorkerPool &operator=(WorkerPool const &other) = delete;
+
+        ~WorkerPool();
+
+        /** Number of threads a job is spread over, the caller included. */
+        size_t size() const;
+
+        /**
+         * Execute `task(idx)` for all idx in [0, count) and wait for 
+         * completion. If a task throws, the remaining indices still run and
+         * the first exception is rethrown here.
+         */
+        void run(size_t count, std::function<void(size_t)> const &task);
+
+    private:
+        /** Process indices of the current job until none are left. */
+        void drain();
+
+        /** Worker thread main loop. */
+        void work();
+};
+
+#endif
@@ -0,0 +1,10 @@
+#include "workerPool.ih"
+
+WorkerPool::WorkerPool(size_t threads)
+:
+    d_size(threads != 0 ? threads : max(1u, thread::hardware_concurrency()))
+{
+    d_threads.reserve(d_size - 1);     // the caller is the d_size-th thread
+    for (size_t idx = 1; idx != d_size; ++idx)
+        d_threads.emplace_back([this]{ work(); });
+}